@@ -0,0 +1,46 @@
+/**
+ * @file bench.h
+ * @brief A minimal timing harness shared by the benchmarks. Build them with -DTOPGG_BUILD_BENCHMARKS=ON, preferably in Release mode.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+
+namespace bench {
+  /**
+   * Keeps the compiler from optimizing a benchmarked value away.
+   */
+  template<typename T>
+  inline void keep(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink{};
+
+    sink = &value;
+#endif
+  }
+
+  /**
+   * Runs a function once to warm up, then repeatedly, and prints the average time per iteration.
+   */
+  template<typename F>
+  double run(const char* name, const size_t iterations, F&& function) {
+    function();
+
+    const auto start{std::chrono::steady_clock::now()};
+
+    for (size_t i{}; i < iterations; i++) {
+      function();
+    }
+
+    const auto elapsed{std::chrono::duration<double, std::nano>{std::chrono::steady_clock::now() - start}.count() / static_cast<double>(iterations)};
+
+    std::printf("%-48s %14.1f ns/op\n", name, elapsed);
+
+    return elapsed;
+  }
+}; // namespace bench
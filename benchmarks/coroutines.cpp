@@ -0,0 +1,149 @@
+/**
+ * Compares awaiting has_voted through the eager topgg::async_result, which keeps its completion state in a dpp::async, against the pooled topgg::lazy_result, directly and from a topgg::task.
+ * Requests are answered from a warm shared cache, so that only the awaiting machinery is measured. Also counts global allocations per request, including one for the frame of the coroutine that drives each coroutine case.
+ * The dpp::async case is only meaningful when built against a real D++, since its cost is D++'s own. The lazy cases never reach D++ on a cache hit.
+ */
+
+#include <topgg/topgg.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(DPP_CORO) && !defined(_WIN32)
+#include <coroutine>
+#include <unistd.h>
+
+static std::atomic<size_t> allocations{};
+
+void* operator new(const size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+
+  const auto memory{std::malloc(size == 0 ? 1 : size)};
+
+  if (memory == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  return memory;
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, TOPGG_UNUSED const size_t size) noexcept {
+  std::free(memory);
+}
+
+namespace topgg {
+  // fills the cache without going through the network
+  class internal_test_access {
+  public:
+    static void store(shared_cache& cache, const dpp::snowflake bot_id, const dpp::snowflake id, const std::string& body) {
+      cache.store(bot_id, shared_cache::vote_endpoint, id, body);
+    }
+  };
+}; // namespace topgg
+
+/**
+ * Starts right away and frees itself once it finishes, so that every benchmarked coroutine runs to completion synchronously.
+ */
+struct detached {
+  struct promise_type {
+    inline detached get_return_object() const noexcept {
+      return {};
+    }
+
+    inline std::suspend_never initial_suspend() const noexcept {
+      return {};
+    }
+
+    inline std::suspend_never final_suspend() const noexcept {
+      return {};
+    }
+
+    inline void return_void() const noexcept {}
+
+    inline void unhandled_exception() const noexcept {
+      std::abort();
+    }
+  };
+};
+
+static constexpr uint64_t BOT_ID = 264811613708746752;
+static constexpr uint64_t USER_ID = 661200758510977084;
+
+static detached await_eager(topgg::client& client, size_t& voted) {
+  voted += co_await client.co_has_voted(USER_ID);
+}
+
+static detached await_lazy(topgg::client& client, size_t& voted) {
+  voted += co_await client.co_has_voted_lazy(USER_ID);
+}
+
+static topgg::task<bool> voted_lazy(topgg::client& client) {
+  co_return co_await client.co_has_voted_lazy(USER_ID);
+}
+
+static detached await_task(topgg::client& client, size_t& voted) {
+  voted += co_await voted_lazy(client);
+}
+
+template<typename F>
+static void measure(const char* name, F&& function) {
+  static constexpr size_t ITERATIONS = 200000;
+
+  function();
+
+  const auto before{allocations.load(std::memory_order_relaxed)};
+
+  bench::run(name, ITERATIONS, function);
+
+  // bench::run also runs the function once to warm up
+  const auto allocated{allocations.load(std::memory_order_relaxed) - before};
+
+  std::printf("%-48s %14.2f allocations/op\n", "", static_cast<double>(allocated) / static_cast<double>(ITERATIONS + 1));
+}
+#endif
+
+int main() {
+#if defined(DPP_CORO) && !defined(_WIN32)
+  const auto name{"/topgg-bench-cache-" + std::to_string(getpid())};
+
+  dpp::cluster bot{"token"};
+  topgg::client client{bot, "token"};
+  topgg::shared_cache cache{name};
+  size_t voted{};
+
+  topgg::internal_test_access::store(cache, BOT_ID, USER_ID, R"({"voted":1})");
+  client.set_shared_cache(&cache, BOT_ID);
+
+  measure("callback has_voted", [&client, &voted]() {
+    client.has_voted(USER_ID, [&voted](const auto& result) {
+      voted += result.get();
+    });
+  });
+
+  measure("co_await co_has_voted (dpp::async)", [&client, &voted]() {
+    await_eager(client, voted);
+  });
+
+  measure("co_await co_has_voted_lazy", [&client, &voted]() {
+    await_lazy(client, voted);
+  });
+
+  measure("co_await co_has_voted_lazy from a topgg::task", [&client, &voted]() {
+    await_task(client, voted);
+  });
+
+  bench::keep(voted);
+  topgg::shared_cache::unlink(name);
+#else
+  std::puts("This benchmark needs C++20 coroutines (-DENABLE_CORO=ON) and a POSIX system.");
+#endif
+
+  return 0;
+}
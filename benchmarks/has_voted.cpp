@@ -0,0 +1,122 @@
+/**
+ * Compares what has_voted does on the caller's thread and on completion against the 2.0.0 code it replaced: formatting the request URL, wrapping the callback for D++, and reading the vote flag out of the response.
+ * The request itself is left out, since the client can only talk to Top.gg. Also counts global allocations per operation.
+ */
+
+#include <topgg/topgg.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> allocations{};
+
+void* operator new(const size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+
+  const auto memory{std::malloc(size == 0 ? 1 : size)};
+
+  if (memory == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  return memory;
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, TOPGG_UNUSED const size_t size) noexcept {
+  std::free(memory);
+}
+
+namespace topgg {
+  class internal_test_access {
+  public:
+    static inline const std::string& vote_url(const dpp::snowflake user_id) {
+      return client::make_url("/bots/votes?userId=", user_id);
+    }
+
+    static inline bool read_vote(const std::string& body) {
+      return client::read_flag(body, "voted");
+    }
+  };
+}; // namespace topgg
+
+static constexpr uint64_t USER_ID = 661200758510977084;
+
+template<typename F>
+static void measure(const char* name, F&& function) {
+  static constexpr size_t ITERATIONS = 200000;
+
+  function();
+
+  const auto before{allocations.load(std::memory_order_relaxed)};
+
+  bench::run(name, ITERATIONS, function);
+
+  // bench::run also runs the function once to warm up
+  const auto allocated{allocations.load(std::memory_order_relaxed) - before};
+
+  std::printf("%-48s %14.2f allocations/op\n", "", static_cast<double>(allocated) / static_cast<double>(ITERATIONS + 1));
+}
+
+int main() {
+  dpp::http_request_completion_t response{};
+  const auto ratelimited_until{std::make_shared<std::atomic<time_t>>(0)};
+  size_t voted{};
+
+  response.status = 200;
+  response.body = R"({"voted":1})";
+
+  // the path was built by has_voted, then prefixed again by basic_request
+  measure("request URL (2.0.0)", []() {
+    const auto path{"/bots/votes?userId=" + std::to_string(USER_ID)};
+
+    bench::keep("https://top.gg/api" + path);
+  });
+
+  measure("request URL", []() {
+    bench::keep(topgg::internal_test_access::vote_url(USER_ID));
+  });
+
+  // has_voted took a const std::function&, which basic_request copied next to a std::function for the conversion, inside of D++'s completion event
+  measure("callback handed to D++ (2.0.0)", [&voted]() {
+    const std::function<void(bool)> callback{[&voted](const bool value) { voted += value; }};
+    std::function<bool(const dpp::json&)> conversion_fn{[](const auto& j) { return j["voted"].template get<uint8_t>() != 0; }};
+
+    dpp::http_completion_event event{[callback, conversion_fn_in = std::move(conversion_fn)](const auto& response) {
+      callback(conversion_fn_in(dpp::json::parse(response.body)));
+    }};
+
+    bench::keep(event);
+  });
+
+  // the callback is moved through cached_request and send, and only D++ wraps it into a std::function
+  measure("callback handed to D++", [&ratelimited_until, &voted]() {
+    std::function<void(bool)> callback{[&voted](const bool value) { voted += value; }};
+
+    dpp::http_completion_event event{[ratelimited_until, callback_in = [callback_in = std::move(callback)](const auto& response) {
+      callback_in(topgg::internal_test_access::read_vote(response.body));
+    }](const auto& response) {
+      callback_in(response);
+    }};
+
+    bench::keep(event);
+  });
+
+  measure("vote flag from the response (2.0.0)", [&response, &voted]() {
+    voted += dpp::json::parse(response.body)["voted"].template get<uint8_t>() != 0;
+  });
+
+  measure("vote flag from the response", [&response, &voted]() {
+    voted += topgg::internal_test_access::read_vote(response.body);
+  });
+
+  bench::keep(voted);
+
+  return 0;
+}
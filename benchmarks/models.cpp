@@ -0,0 +1,269 @@
+/**
+ * Compares deserializing a page of bots through the compile-time field tables against the exception-driven macros they replaced.
+ * Also compares deserializing a large list of bots on the calling thread against spreading it across the parser pool, which bot_query::parallel uses,
+ * and filtering that list as a std::vector<topgg::bot> against filtering it as a topgg::bot_table.
+ */
+
+#include <topgg/topgg.h>
+
+#include "bench.h"
+
+#include <algorithm>
+#include <numeric>
+#include <ctime>
+#include <thread>
+
+#define DESERIALIZE(j, name, type) \
+  name = j[#name].template get<type>()
+
+#define DESERIALIZE_ALIAS(j, name, prop, type) \
+  prop = j[#name].template get<type>()
+
+#define IGNORE_EXCEPTION(scope) \
+  try scope catch (TOPGG_UNUSED const std::exception&) {}
+
+#define DESERIALIZE_VECTOR(j, name, type)                  \
+  IGNORE_EXCEPTION({                                       \
+    name = j[#name].template get<std::vector<type>>();     \
+  })
+
+#define DESERIALIZE_OPTIONAL_STRING(j, name)                      \
+  IGNORE_EXCEPTION({                                              \
+    const auto value{j[#name].template get<std::string>()};       \
+                                                                  \
+    if (value.size() > 0) {                                       \
+      name = std::optional{value};                                \
+    }                                                             \
+  })
+
+#define DESERIALIZE_OPTIONAL_STRING_ALIAS(j, name, prop)          \
+  IGNORE_EXCEPTION({                                              \
+    const auto value{j[#name].template get<std::string>()};       \
+                                                                  \
+    if (value.size() > 0) {                                       \
+      prop = std::optional{value};                                \
+    }                                                             \
+  })
+
+/**
+ * The bot model as it was deserialized before the field tables, kept verbatim for comparison.
+ */
+struct legacy_bot {
+  dpp::snowflake id;
+  std::string username, avatar, discriminator, prefix, short_description, invite, url{"https://top.gg/bot/"};
+  std::optional<std::string> long_description, website, github, banner, support;
+  std::vector<std::string> tags;
+  std::vector<dpp::snowflake> owners;
+  time_t created_at, approved_at;
+  size_t votes, monthly_votes, shard_count;
+  bool is_certified;
+
+  legacy_bot(const dpp::json& j) {
+    id = dpp::snowflake{j["id"].template get<std::string>()};
+
+    DESERIALIZE(j, username, std::string);
+
+    try {
+      const auto hash{j["avatar"].template get<std::string>()};
+      const char* ext{hash.rfind("a_", 0) == 0 ? "gif" : "png"};
+
+      avatar = "https://cdn.discordapp.com/avatars/" + std::to_string(id) + "/" + hash + "." + ext + "?size=1024";
+    } catch (TOPGG_UNUSED const std::exception&) {
+      avatar = "https://cdn.discordapp.com/embed/avatars/" + std::to_string((id >> 22) % 6) + ".png";
+    }
+
+    created_at = static_cast<time_t>(((id >> 22) / 1000) + 1420070400);
+    discriminator = "0";
+
+    DESERIALIZE(j, prefix, std::string);
+    DESERIALIZE_ALIAS(j, shortdesc, short_description, std::string);
+    DESERIALIZE_OPTIONAL_STRING_ALIAS(j, longdesc, long_description);
+    DESERIALIZE_VECTOR(j, tags, std::string);
+    DESERIALIZE_OPTIONAL_STRING(j, website);
+    DESERIALIZE_OPTIONAL_STRING(j, github);
+
+    IGNORE_EXCEPTION({
+      const auto j_owners{j["owners"].template get<std::vector<std::string>>()};
+
+      owners.reserve(j_owners.size());
+
+      for (const auto& owner: j_owners) {
+        owners.push_back(dpp::snowflake{owner});
+      }
+    });
+
+    DESERIALIZE_OPTIONAL_STRING_ALIAS(j, bannerUrl, banner);
+
+    const auto j_approved_at{j["date"].template get<std::string>()};
+    tm approved_at_tm{};
+
+    strptime(j_approved_at.data(), "%Y-%m-%dT%H:%M:%S", &approved_at_tm);
+    approved_at = mktime(&approved_at_tm);
+
+    is_certified = false;
+
+    DESERIALIZE_ALIAS(j, points, votes, size_t);
+    DESERIALIZE_ALIAS(j, monthlyPoints, monthly_votes, size_t);
+
+    try {
+      DESERIALIZE(j, invite, std::string);
+    } catch (TOPGG_UNUSED const std::exception&) {
+      invite = "https://discord.com/oauth2/authorize?scope=bot&client_id=" + std::to_string(id);
+    }
+
+    IGNORE_EXCEPTION({
+      const auto j_support{j["support"].template get<std::string>()};
+
+      if (j_support.size() > 0) {
+        support = std::optional{"https://discord.com/invite/" + j_support};
+      }
+    });
+
+    shard_count = 0;
+
+    try {
+      url.append(j["vanity"].template get<std::string>());
+    } catch (TOPGG_UNUSED const std::exception&) {
+      url.append(std::to_string(id));
+    }
+  }
+};
+
+/**
+ * A page of bots shaped like the API's responses, where most optional fields are null.
+ */
+static std::string make_page(const size_t count) {
+  std::string page{"{\"results\":["};
+
+  for (size_t i{}; i < count; i++) {
+    const auto id{std::to_string(264811613708746752 + i)};
+
+    if (i != 0) {
+      page.push_back(',');
+    }
+
+    page += "{\"id\":\"" + id + "\",\"clientid\":\"" + id + "\",\"username\":\"Bot " + std::to_string(i) + "\",\"discriminator\":\"0\",\"avatar\":" + (i % 3 == 0 ? "null" : "\"a_0123456789abcdef\"") + ",\"prefix\":\"!\",\"shortdesc\":\"A short description for a bot listed on Top.gg.\",\"longdesc\":\"" + std::string(400, 'x') + "\",\"tags\":[\"Music\",\"Moderation\",\"Fun\"],\"website\":null,\"support\":\"" + (i % 2 == 0 ? "" : "dbl") + "\",\"github\":null,\"owners\":[\"121919449996460033\"],\"guilds\":[],\"invite\":null,\"date\":\"2020-0" + std::to_string(1 + i % 9) + "-1" + std::to_string(i % 10) + "T12:34:56.789Z\",\"server_count\":" + std::to_string(1000 + i) + ",\"shard_count\":0,\"certifiedBot\":false,\"vanity\":" + (i % 4 == 0 ? "\"vanity" + std::to_string(i) + "\"" : "null") + ",\"points\":" + std::to_string(100 * i) + ",\"monthlyPoints\":" + std::to_string(i) + ",\"donatebotguildid\":\"\",\"bannerUrl\":null}";
+  }
+
+  page += "],\"limit\":" + std::to_string(count) + ",\"offset\":0,\"count\":" + std::to_string(count) + ",\"total\":" + std::to_string(count) + "}";
+
+  return page;
+}
+
+int main() {
+  static constexpr size_t BOTS = 500;
+  static constexpr size_t ITERATIONS = 50;
+
+  const auto page{make_page(BOTS)};
+  const auto dom = dpp::json::parse(page);
+  const auto& results{dom["results"]};
+  auto model{topgg::internal_parser::parse<topgg::bot>(results[0].dump())};
+
+  std::printf("%zu bots per page, %zu bytes\n\n", BOTS, page.size());
+
+  const auto macros{bench::run("already parsed page, exception macros", ITERATIONS, [&results]() {
+    for (const auto& j: results) {
+      bench::keep(legacy_bot{j});
+    }
+  })};
+
+  const auto tables{bench::run("already parsed page, field tables", ITERATIONS, [&results, &model]() {
+    for (const auto& j: results) {
+      topgg::internal_parser::deserialize(j, model);
+      bench::keep(model);
+    }
+  })};
+
+  bench::run("raw page, DOM then exception macros", ITERATIONS, [&page]() {
+    const auto j = dpp::json::parse(page);
+
+    for (const auto& element: j["results"]) {
+      bench::keep(legacy_bot{element});
+    }
+  });
+
+  bench::run("raw page, SAX reader and field tables", ITERATIONS, [&page]() {
+    bench::keep(topgg::internal_parser::parse_array<topgg::bot>(page, "results"));
+  });
+
+  std::printf("\nfield tables: %.2fx the speed of the exception macros\n", macros / tables);
+
+  static constexpr size_t LARGE_BOTS = 10000;
+
+  const auto large_page{make_page(LARGE_BOTS)};
+  const auto cores{std::max(std::thread::hardware_concurrency(), 1u)};
+
+  std::printf("\n%zu bots, %zu bytes, %u cores\n\n", LARGE_BOTS, large_page.size(), cores);
+
+  const auto serial{bench::run("large list, calling thread", ITERATIONS, [&large_page]() {
+    bench::keep(topgg::internal_parser::parse_array<topgg::bot>(large_page, "results"));
+  })};
+
+  for (const size_t threads: {size_t{1}, size_t{2}, size_t{4}, size_t{cores}}) {
+    char name[48]{};
+
+    std::snprintf(name, sizeof(name), "large list, parser pool, %zu threads", threads);
+
+    const auto parallel{bench::run(name, ITERATIONS, [&large_page, threads]() {
+      bench::keep(topgg::internal_parser::parse_array_parallel<topgg::bot>(large_page, "results", threads));
+    })};
+
+    std::printf("%-48s %14.2fx\n", "", serial / parallel);
+  }
+
+  static constexpr size_t SCAN_ITERATIONS = 1000;
+
+  const auto bots{topgg::internal_parser::parse_array<topgg::bot>(large_page, "results")};
+  const auto table{topgg::internal_parser::parse_table(large_page, "results")};
+  const size_t min_votes{50 * LARGE_BOTS};
+
+  std::printf("\n");
+
+  const auto vector_votes{bench::run("votes >= min, std::vector<topgg::bot>", SCAN_ITERATIONS, [&bots]() {
+    std::vector<uint32_t> rows{};
+
+    for (size_t i{}; i < bots.size(); i++) {
+      if (bots[i].votes >= min_votes) {
+        rows.push_back(static_cast<uint32_t>(i));
+      }
+    }
+
+    bench::keep(rows);
+  })};
+
+  const auto table_votes{bench::run("votes >= min, topgg::bot_table", SCAN_ITERATIONS, [&table]() {
+    bench::keep(table.filter_votes(min_votes));
+  })};
+
+  std::printf("%-48s %14.2fx\n", "", vector_votes / table_votes);
+
+  const auto vector_tag{bench::run("has tag, std::vector<topgg::bot>", SCAN_ITERATIONS, [&bots]() {
+    std::vector<uint32_t> rows{};
+
+    for (size_t i{}; i < bots.size(); i++) {
+      if (std::find(bots[i].tags.begin(), bots[i].tags.end(), "Fun") != bots[i].tags.end()) {
+        rows.push_back(static_cast<uint32_t>(i));
+      }
+    }
+
+    bench::keep(rows);
+  })};
+
+  const auto table_tag{bench::run("has tag, topgg::bot_table", SCAN_ITERATIONS, [&table]() {
+    bench::keep(table.filter_tag("Fun"));
+  })};
+
+  std::printf("%-48s %14.2fx\n", "", vector_tag / table_tag);
+
+  const auto vector_total{bench::run("total votes, std::vector<topgg::bot>", SCAN_ITERATIONS, [&bots]() {
+    bench::keep(std::accumulate(bots.begin(), bots.end(), uint64_t{}, [](const uint64_t total, const topgg::bot& bot) { return total + bot.votes; }));
+  })};
+
+  const auto table_total{bench::run("total votes, topgg::bot_table", SCAN_ITERATIONS, [&table]() {
+    bench::keep(table.total_votes());
+  })};
+
+  std::printf("%-48s %14.2fx\n", "", vector_total / table_total);
+
+  return 0;
+}
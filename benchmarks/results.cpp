@@ -0,0 +1,123 @@
+/**
+ * Counts the allocations made between a response arriving and the user's callback reading it, against the 2.0.0 code that copied the whole response into every result.
+ * D++ only lends its responses out, so their body is still copied once. Responses the client owns, such as cache hits, are moved into the result instead.
+ */
+
+#include <topgg/topgg.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+static std::atomic<size_t> allocations{};
+
+void* operator new(const size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+
+  const auto memory{std::malloc(size == 0 ? 1 : size)};
+
+  if (memory == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  return memory;
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, TOPGG_UNUSED const size_t size) noexcept {
+  std::free(memory);
+}
+
+namespace topgg {
+  class internal_test_access {
+  public:
+    template<typename R>
+    static size_t body_size(R&& response) {
+      return result<size_t>{std::forward<R>(response), [](std::string& body) { return body.size(); }}.get();
+    }
+  };
+}; // namespace topgg
+
+/**
+ * What 2.0.0's result held: a copy of the whole response, header map included, and a copy of the conversion's std::function.
+ */
+class legacy_result {
+  const dpp::http_request_completion_t m_response;
+  const std::function<size_t(const std::string&)> m_parse_fn;
+
+public:
+  inline legacy_result(const dpp::http_request_completion_t& response, const std::function<size_t(const std::string&)>& parse_fn)
+    : m_response(response), m_parse_fn(parse_fn) {}
+
+  inline size_t get() const {
+    return m_parse_fn(m_response.body);
+  }
+};
+
+template<typename F>
+static void measure(const char* name, F&& function) {
+  static constexpr size_t ITERATIONS = 200000;
+
+  function();
+
+  const auto before{allocations.load(std::memory_order_relaxed)};
+
+  bench::run(name, ITERATIONS, function);
+
+  // bench::run also runs the function once to warm up
+  const auto allocated{allocations.load(std::memory_order_relaxed) - before};
+
+  std::printf("%-48s %14.2f allocations/op\n", "", static_cast<double>(allocated) / static_cast<double>(ITERATIONS + 1));
+}
+
+int main() {
+  dpp::http_request_completion_t response{};
+  size_t read{};
+
+  response.status = 200;
+  response.body = R"({"id":"661200758510977084","username":"null8626","avatar":"https://cdn.discordapp.com/avatars/661200758510977084/a_0123456789abcdef.png","bio":"A short bio.","banner":null,"social":{},"supporter":false,"certifiedDev":false,"mod":false,"webMod":false,"admin":false})";
+
+  // what Top.gg's responses usually carry
+  for (const auto& header: {"access-control-allow-origin", "alt-svc", "cache-control", "cf-cache-status", "cf-ray", "content-length", "content-type", "date", "etag", "nel", "report-to", "server"}) {
+    response.headers.emplace(header, "a header value that doesn't fit into a small string");
+  }
+
+  const std::function<size_t(const std::string&)> legacy_parse_fn{[](const std::string& body) { return body.size(); }};
+
+  measure("D++ response (2.0.0)", [&response, &legacy_parse_fn, &read]() {
+    read += legacy_result{response, legacy_parse_fn}.get();
+  });
+
+  measure("D++ response", [&response, &read]() {
+    read += topgg::internal_test_access::body_size(response);
+  });
+
+  // the cache fills a fresh response for every hit, which costs one allocation for the body either way
+  measure("cache hit, copied into the result", [&response, &read]() {
+    dpp::http_request_completion_t hit{};
+
+    hit.status = 200;
+    hit.body = response.body;
+
+    read += topgg::internal_test_access::body_size(static_cast<const dpp::http_request_completion_t&>(hit));
+  });
+
+  measure("cache hit, moved into the result", [&response, &read]() {
+    dpp::http_request_completion_t hit{};
+
+    hit.status = 200;
+    hit.body = response.body;
+
+    read += topgg::internal_test_access::body_size(std::move(hit));
+  });
+
+  bench::keep(read);
+
+  return 0;
+}
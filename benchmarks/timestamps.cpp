@@ -0,0 +1,71 @@
+/**
+ * Compares the locale-free ISO 8601 parser against strptime and mktime, which bots were parsed with before, over a page of 500 approval dates.
+ */
+
+#include <topgg/topgg.h>
+
+#include "bench.h"
+
+#include <ctime>
+
+int main() {
+#ifdef _WIN32
+  std::puts("strptime is unavailable on Windows.");
+#else
+  static constexpr size_t DATES = 500;
+  static constexpr size_t ITERATIONS = 2000;
+
+  std::vector<std::string> dates{};
+
+  dates.reserve(DATES);
+
+  for (size_t i{}; i < DATES; i++) {
+    char date[32]{};
+
+    std::snprintf(date, sizeof(date), "20%02zu-%02zu-%02zuT%02zu:%02zu:%02zu.%03zuZ", 17 + i % 9, 1 + i % 12, 1 + i % 28, i % 24, i % 60, (i * 7) % 60, i % 1000);
+    dates.emplace_back(date);
+  }
+
+  // the parsers must agree before their speed is compared
+  for (const auto& date: dates) {
+    tm parsed{};
+
+    strptime(date.data(), "%Y-%m-%dT%H:%M:%S", &parsed);
+
+    if (timegm(&parsed) != topgg::internal_parser::parse_timestamp(date)) {
+      std::fprintf(stderr, "mismatch on %s\n", date.data());
+      return 1;
+    }
+  }
+
+  std::printf("%zu dates per page\n\n", DATES);
+
+  const auto libc{bench::run("page, strptime and mktime", ITERATIONS, [&dates]() {
+    for (const auto& date: dates) {
+      tm parsed{};
+
+      strptime(date.data(), "%Y-%m-%dT%H:%M:%S", &parsed);
+      bench::keep(mktime(&parsed));
+    }
+  })};
+
+  bench::run("page, strptime and timegm", ITERATIONS, [&dates]() {
+    for (const auto& date: dates) {
+      tm parsed{};
+
+      strptime(date.data(), "%Y-%m-%dT%H:%M:%S", &parsed);
+      bench::keep(timegm(&parsed));
+    }
+  });
+
+  const auto iso{bench::run("page, internal_parser::parse_timestamp", ITERATIONS, [&dates]() {
+    for (const auto& date: dates) {
+      bench::keep(topgg::internal_parser::parse_timestamp(date));
+    }
+  })};
+
+  std::printf("\nparse_timestamp: %.2fx the speed of strptime and mktime\n", libc / iso);
+#endif
+
+  return 0;
+}
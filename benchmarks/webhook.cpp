@@ -0,0 +1,143 @@
+/**
+ * Measures the webhook server's throughput over loopback, with keep-alive connections that either wait for every response or pipeline their requests.
+ * Usage: bench_webhook [connections] [requests per connection] [port]
+ */
+
+#include <topgg/topgg.h>
+
+#ifdef __linux__
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+static int connect_loopback(const uint16_t port) {
+  const auto fd{socket(AF_INET, SOCK_STREAM, 0)};
+  sockaddr_in address{};
+
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+
+  if (fd < 0 || connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+    std::perror("connect");
+    std::exit(1);
+  }
+
+  return fd;
+}
+
+/**
+ * Every response is header-only, so counting header terminators counts responses.
+ */
+static bool read_responses(const int fd, size_t count) {
+  char buffer[16384];
+  size_t matched{};
+
+  while (count != 0) {
+    const auto received{recv(fd, buffer, sizeof(buffer), 0)};
+
+    if (received <= 0) {
+      return false;
+    }
+
+    for (ssize_t i{}; i < received; i++) {
+      static constexpr char terminator[]{"\r\n\r\n"};
+
+      matched = buffer[i] == terminator[matched] ? matched + 1 : (buffer[i] == '\r' ? 1 : 0);
+
+      if (matched == 4) {
+        matched = 0;
+        count--;
+      }
+    }
+  }
+
+  return true;
+}
+
+static double run_load(const char* name, const uint16_t port, const size_t connections, const size_t requests, const size_t batch, const std::string& request) {
+  std::vector<std::thread> threads{};
+  std::atomic<bool> failed{};
+  const auto start{std::chrono::steady_clock::now()};
+
+  for (size_t i{}; i < connections; i++) {
+    threads.emplace_back([&]() {
+      const auto fd{connect_loopback(port)};
+      std::string pipelined{};
+
+      for (size_t j{}; j < batch; j++) {
+        pipelined.append(request);
+      }
+
+      for (size_t sent{}; sent < requests; sent += batch) {
+        const auto count{std::min(batch, requests - sent)};
+
+        if (send(fd, pipelined.data(), request.size() * count, MSG_NOSIGNAL) < 0 || !read_responses(fd, count)) {
+          failed = true;
+          break;
+        }
+      }
+
+      close(fd);
+    });
+  }
+
+  for (auto& thread: threads) {
+    thread.join();
+  }
+
+  const auto elapsed{std::chrono::duration<double>{std::chrono::steady_clock::now() - start}.count()};
+  const auto rate{static_cast<double>(connections * requests) / elapsed};
+
+  std::printf("%-48s %14.0f req/s%s\n", name, rate, failed ? " (failed)" : "");
+
+  return rate;
+}
+#endif
+
+int main(TOPGG_UNUSED int argc, TOPGG_UNUSED char** argv) {
+#ifdef __linux__
+  const size_t connections{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 8};
+  const size_t requests{argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000};
+  const auto port{static_cast<uint16_t>(argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 18090)};
+
+  std::atomic<size_t> received{};
+  topgg::webhook_options options{};
+
+  options.address = "127.0.0.1";
+  options.port = port;
+  options.workers = 2;
+
+  topgg::webhook_server server{options};
+
+  server.route("/votes", "benchmark", [&received](TOPGG_UNUSED const topgg::webhook_vote& vote) {
+    received.fetch_add(1, std::memory_order_relaxed);
+  });
+
+  server.start();
+
+  const std::string body{R"({"bot":"264811613708746752","user":"121919449996460033","type":"upvote","isWeekend":false,"query":"?source=bench"})"};
+  const std::string request{"POST /votes HTTP/1.1\r\nHost: 127.0.0.1\r\nAuthorization: benchmark\r\nContent-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body};
+
+  std::printf("%zu connections, %zu requests each\n\n", connections, requests);
+
+  run_load("keep-alive, one request at a time", port, connections, requests, 1, request);
+  run_load("keep-alive, 64 pipelined requests", port, connections, requests, 64, request);
+
+  server.stop();
+
+  std::printf("\n%zu votes dispatched\n", received.load());
+#else
+  std::puts("The webhook server is only available on Linux.");
+#endif
+
+  return 0;
+}
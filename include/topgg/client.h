@@ -12,19 +12,28 @@
 
 #include <topgg/topgg.h>
 
+#include <unordered_set>
+#include <string_view>
+#include <optional>
+#include <atomic>
 #include <functional>
 #include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
 #include <map>
 
 namespace topgg {
+  class multi_client;
+  class shared_cache;
+
   /**
    * @brief The callback function to call when get_bot completes.
    *
    * @see topgg::client::get_bot
    * @since 2.0.0
    */
-  using get_bot_completion_t = std::function<void(const result<bot>&)>;
+  using get_bot_completion_t = std::function<void(result<bot>&)>;
 
   /**
    * @brief The callback function to call when get_user completes.
@@ -32,7 +41,7 @@ namespace topgg {
    * @see topgg::client::get_user
    * @since 2.0.0
    */
-  using get_user_completion_t = std::function<void(const result<user>&)>;
+  using get_user_completion_t = std::function<void(result<user>&)>;
 
   /**
    * @brief The callback function to call when get_stats completes.
@@ -40,7 +49,7 @@ namespace topgg {
    * @see topgg::client::get_stats
    * @since 2.0.0
    */
-  using get_stats_completion_t = std::function<void(const result<stats>&)>;
+  using get_stats_completion_t = std::function<void(result<stats>&)>;
 
   /**
    * @brief The callback function to call when get_voters completes.
@@ -48,7 +57,7 @@ namespace topgg {
    * @see topgg::client::get_voters
    * @since 2.0.0
    */
-  using get_voters_completion_t = std::function<void(const result<std::vector<voter>>&)>;
+  using get_voters_completion_t = std::function<void(result<std::vector<voter>>&)>;
 
   /**
    * @brief The callback function to call when has_voted completes.
@@ -56,7 +65,7 @@ namespace topgg {
    * @see topgg::client::has_voted
    * @since 2.0.0
    */
-  using has_voted_completion_t = std::function<void(const result<bool>&)>;
+  using has_voted_completion_t = std::function<void(result<bool>&)>;
 
   /**
    * @brief The callback function to call when is_weekend completes.
@@ -64,7 +73,7 @@ namespace topgg {
    * @see topgg::client::is_weekend
    * @since 2.0.0
    */
-  using is_weekend_completion_t = std::function<void(const result<bool>&)>;
+  using is_weekend_completion_t = std::function<void(result<bool>&)>;
   
   /**
    * @brief The callback function to call when post_stats completes.
@@ -81,6 +90,99 @@ namespace topgg {
    * @since 2.0.0
    */
   using custom_autopost_callback_t = std::function<::topgg::stats(dpp::cluster&)>;
+
+  /**
+   * @brief The callback function to call for every new vote found by the vote detector.
+   *
+   * @see topgg::client::start_vote_detector
+   * @since 2.1.0
+   */
+  using vote_detected_callback_t = std::function<void(const voter&)>;
+
+  /**
+   * @brief Tuning options for the autoposter.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::autoposter_options options{};
+   *
+   * options.delay = 3600;
+   * options.threshold = 10;
+   *
+   * topgg_client.start_autoposter(options);
+   * ```
+   *
+   * @see topgg::client::start_autoposter
+   * @since 2.1.0
+   */
+  struct autoposter_options {
+    /**
+     * @brief The delay between server count checks in seconds. Must not be shorter than 15 minutes. Defaults to 30 minutes.
+     *
+     * @since 2.1.0
+     */
+    time_t delay = 1800;
+
+    /**
+     * @brief The minimum change in server count since the last successful post before posting again. Zero posts on every check. Defaults to one.
+     *
+     * @since 2.1.0
+     */
+    size_t threshold = 1;
+
+    /**
+     * @brief The delay before retrying a failed post in seconds. Doubles on every consecutive failure, up to the delay above. Defaults to 1 minute.
+     *
+     * @since 2.1.0
+     */
+    time_t retry_delay = 60;
+
+    /**
+     * @brief Whether to check the server count once every shard became ready instead of waiting for the next check. Defaults to true.
+     *
+     * @see topgg::autoposter_options::ready_delay
+     * @since 2.1.0
+     */
+    bool post_on_ready = true;
+
+    /**
+     * @brief How long to wait after the last shard became ready before checking the server count in seconds, so that every shard has received its servers. Defaults to 30 seconds.
+     *
+     * @see topgg::autoposter_options::post_on_ready
+     * @since 2.1.0
+     */
+    time_t ready_delay = 30;
+  };
+
+  /**
+   * @brief A snapshot of the autoposter's counters.
+   *
+   * @see topgg::client::get_autoposter_metrics
+   * @since 2.1.0
+   */
+  struct autoposter_metrics {
+    /**
+     * @brief The amount of stats posts accepted by Top.gg.
+     *
+     * @since 2.1.0
+     */
+    size_t posted;
+
+    /**
+     * @brief The amount of checks where the server count didn't move enough to be posted.
+     *
+     * @since 2.1.0
+     */
+    size_t skipped;
+
+    /**
+     * @brief The amount of stats posts that failed and were scheduled for a retry.
+     *
+     * @since 2.1.0
+     */
+    size_t failed;
+  };
   
   /**
    * @brief Main client class that lets you make HTTP requests with the Top.gg API.
@@ -91,11 +193,154 @@ namespace topgg {
     std::multimap<std::string, std::string> m_headers;
     std::string m_token;
     dpp::cluster& m_cluster;
+    multi_client* m_owner;
+    shared_cache* m_cache;
+    dpp::snowflake m_cache_bot_id;
+    std::shared_ptr<std::atomic<time_t>> m_ratelimited_until;
     dpp::timer m_autoposter_timer;
+    dpp::timer m_vote_detector_timer;
+
+    struct vote_detector_state {
+      std::mutex mutex;
+      std::unordered_set<dpp::snowflake> seen;
+      vote_detected_callback_t callback;
+      time_t min_delay{};
+      time_t max_delay{};
+      time_t last_poll{};
+      time_t next_poll{};
+      double votes_per_second{};
+      bool has_snapshot{};
+      bool in_flight{};
+      bool running{};
+    };
+
+    std::shared_ptr<vote_detector_state> m_vote_detector;
+
+    struct autoposter_state {
+      std::mutex mutex;
+      custom_autopost_callback_t callback;
+      autoposter_options options;
+      std::optional<size_t> last_posted;
+      std::unordered_set<uint32_t> ready_shards;
+      time_t next_check{};
+      time_t backoff{};
+      bool in_flight{};
+      bool running{};
+      dpp::event_handle ready_handle{};
+      std::atomic<size_t> posted{};
+      std::atomic<size_t> skipped{};
+      std::atomic<size_t> failed{};
+    };
+
+    /**
+     * Shared with in-flight posts, so that the client can be destroyed while one is still pending.
+     */
+    std::shared_ptr<autoposter_state> m_autoposter;
+    internal_liveness m_liveness;
+
+    client(multi_client& owner, dpp::cluster& cluster, const std::string& token);
+
+    void poll_votes();
+    void autopost();
+
+    dpp::timer start_timer(std::function<void()> callback, const time_t interval);
+    void stop_timer(const dpp::timer timer) noexcept;
+    time_t get_ratelimit_remaining() const noexcept;
+    static dpp::http_request_completion_t make_ratelimited_response(const time_t retry_after);
+    static const std::string& make_url(const std::string_view path);
+    static const std::string& make_url(const std::string_view prefix, const dpp::snowflake id);
+    static bool read_flag(const std::string& body, const std::string_view key);
+    static void record_ratelimit(std::atomic<time_t>& ratelimited_until, const dpp::http_request_completion_t& response) noexcept;
+
+#ifndef _WIN32
+    bool find_cached(const uint32_t endpoint, const dpp::snowflake id, std::string& body) const;
+    static void store_cached(shared_cache* cache, const dpp::snowflake bot_id, const uint32_t endpoint, const dpp::snowflake id, const dpp::http_request_completion_t& response) noexcept;
+#endif
+
+    /**
+     * The callback is only wrapped into a std::function once, by D++ itself.
+     * It always runs on one of D++'s threads and never before send returns, so callers may hold locks that the callback takes too.
+     */
+    template<typename F>
+    void send(const std::string& url, const dpp::http_method method, F&& callback, const std::string& body, const std::multimap<std::string, std::string>& headers) {
+      const auto retry_after{get_ratelimit_remaining()};
+
+      // sending while ratelimited would only extend the ratelimit, so fail with what Top.gg would've responded with, from D++'s thread pool like a real response
+      if (retry_after != 0) {
+        m_cluster.queue_work(0, [retry_after, callback_in = std::forward<F>(callback)]() {
+          callback_in(make_ratelimited_response(retry_after));
+        });
+
+        return;
+      }
+
+      // too long for the small string buffer, so it isn't rebuilt on every request
+      static const std::string content_type{"application/json"};
+
+      m_cluster.request(url, method, [ratelimited_until = m_ratelimited_until, callback_in = std::forward<F>(callback)](const auto& response) {
+        record_ratelimit(*ratelimited_until, response);
+        callback_in(response);
+      }, body, content_type, headers);
+    }
+
+    template<typename F>
+    void send_cached(const uint32_t endpoint, const dpp::snowflake id, const std::string_view prefix, F&& callback) {
+#ifndef _WIN32
+      if (m_cache != nullptr) {
+        dpp::http_request_completion_t response{};
+
+        if (find_cached(endpoint, id, response.body)) {
+          response.status = 200;
+
+          callback(std::move(response));
+          return;
+        }
+      }
+#endif
+
+      const auto& url{make_url(prefix, id)};
+
+#ifndef _WIN32
+      if (m_cache != nullptr) {
+        send(url, dpp::m_get, [cache = m_cache, bot_id = m_cache_bot_id, endpoint, id, callback_in = std::forward<F>(callback)](const auto& response) {
+          store_cached(cache, bot_id, endpoint, id, response);
+          callback_in(response);
+        }, "", m_headers);
+
+        return;
+      }
+#endif
+
+      send(url, dpp::m_get, std::forward<F>(callback), "", m_headers);
+    }
+
+    template<typename T, typename F>
+    void send_parsed(const std::string& url, F&& callback, typename result<T>::conversion_fn_t conversion_fn) {
+      send(url, dpp::m_get, [callback_in = std::forward<F>(callback), conversion_fn](auto&& response) {
+        result<T> r{std::forward<decltype(response)>(response), conversion_fn};
+
+        callback_in(r);
+      }, "", m_headers);
+    }
+
+    template<typename T, typename F>
+    inline void basic_request(const std::string_view path, F&& callback, typename result<T>::conversion_fn_t conversion_fn) {
+      send_parsed<T>(make_url(path), std::forward<F>(callback), conversion_fn);
+    }
 
-    template<typename T>
-    void basic_request(const std::string& url, const std::function<void(const result<T>&)>& callback, std::function<T(const dpp::json&)>&& conversion_fn) {
-      m_cluster.request("https://top.gg/api" + url, dpp::m_get, [callback, conversion_fn_in = std::move(conversion_fn)](const auto& response) { callback(result<T>{response, conversion_fn_in}); }, "", "application/json", m_headers);
+    template<typename T, typename F>
+    inline void basic_request(const std::string_view prefix, const dpp::snowflake id, F&& callback, typename result<T>::conversion_fn_t conversion_fn) {
+      send_parsed<T>(make_url(prefix, id), std::forward<F>(callback), conversion_fn);
+    }
+
+    template<typename T, typename F>
+    void cached_request(const uint32_t endpoint, const dpp::snowflake id, const std::string_view prefix, F&& callback, typename result<T>::conversion_fn_t conversion_fn) {
+      // cache hits hand over a response of their own, which the result can take the body from
+      send_cached(endpoint, id, prefix, [callback_in = std::forward<F>(callback), conversion_fn](auto&& response) {
+        result<T> r{std::forward<decltype(response)>(response), conversion_fn};
+
+        callback_in(r);
+      });
     }
     
   public:
@@ -172,7 +417,7 @@ namespace topgg {
      * @see topgg::client::co_get_bot
      * @since 2.0.0
      */
-    void get_bot(const dpp::snowflake bot_id, const get_bot_completion_t& callback);
+    void get_bot(const dpp::snowflake bot_id, get_bot_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -207,6 +452,17 @@ namespace topgg {
      * @since 2.0.0
      */
     topgg::async_result<topgg::bot> co_get_bot(const dpp::snowflake bot_id);
+
+    /**
+     * @brief The lazy counterpart of co_get_bot, which only sends the request once it's awaited.
+     *
+     * @param bot_id The Discord bot ID to fetch from.
+     * @return co_await to retrieve a topgg::bot if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_get_bot
+     * @since 2.1.0
+     */
+    topgg::lazy_result<topgg::bot> co_get_bot_lazy(const dpp::snowflake bot_id);
 #endif
 
     /**
@@ -296,7 +552,7 @@ namespace topgg {
      * @see topgg::co_get_user
      * @since 2.0.0
      */
-    void get_user(const dpp::snowflake user_id, const get_user_completion_t& callback);
+    void get_user(const dpp::snowflake user_id, get_user_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -331,6 +587,143 @@ namespace topgg {
      * @since 2.0.0
      */
     topgg::async_result<topgg::user> co_get_user(const dpp::snowflake user_id);
+
+    /**
+     * @brief The lazy counterpart of co_get_user, which only sends the request once it's awaited.
+     *
+     * @param user_id The Discord user ID to fetch from.
+     * @return co_await to retrieve a topgg::user if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_get_user
+     * @since 2.1.0
+     */
+    topgg::lazy_result<topgg::user> co_get_user_lazy(const dpp::snowflake user_id);
+#endif
+
+    /**
+     * @brief Fetches a listed Discord bot from a Discord ID as a view over the retained response body.
+     *
+     * Unlike get_bot, no field is copied out of the response body, and derived URLs are only built when accessed.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg_client.get_bot_view(264811613708746752, [](auto& result) {
+     *   try {
+     *     const auto& topgg_bot = result.get();
+     *
+     *     std::cout << topgg_bot.username() << " " << topgg_bot.url() << std::endl;
+     *   } catch (const std::exception& exc) {
+     *     std::cerr << "error: " << exc.what() << std::endl;
+     *   }
+     * });
+     * ```
+     *
+     * @param bot_id The Discord bot ID to fetch from.
+     * @param callback The callback function to call when get_bot_view completes.
+     * @note For its C++20 coroutine counterpart, see co_get_bot_view.
+     * @see topgg::result
+     * @see topgg::bot_view
+     * @see topgg::client::get_bot
+     * @see topgg::client::co_get_bot_view
+     * @since 2.1.0
+     */
+    void get_bot_view(const dpp::snowflake bot_id, get_bot_view_completion_t callback);
+
+#ifdef DPP_CORO
+    /**
+     * @brief Fetches a listed Discord bot from a Discord ID as a view over the retained response body through a C++20 coroutine.
+     *
+     * @param bot_id The Discord bot ID to fetch from.
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return co_await to retrieve a topgg::bot_view if successful
+     * @note For its C++17 callback-based counterpart, see get_bot_view.
+     * @see topgg::async_result
+     * @see topgg::bot_view
+     * @see topgg::client::get_bot_view
+     * @since 2.1.0
+     */
+    topgg::async_result<topgg::bot_view> co_get_bot_view(const dpp::snowflake bot_id);
+
+    /**
+     * @brief The lazy counterpart of co_get_bot_view, which only sends the request once it's awaited.
+     *
+     * @param bot_id The Discord bot ID to fetch from.
+     * @return co_await to retrieve a topgg::bot_view if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_get_bot_view
+     * @since 2.1.0
+     */
+    topgg::lazy_result<topgg::bot_view> co_get_bot_view_lazy(const dpp::snowflake bot_id);
+#endif
+
+    /**
+     * @brief Fetches a user from a Discord ID as a view over the retained response body.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg_client.get_user_view(661200758510977084, [](auto& result) {
+     *   try {
+     *     const auto& user = result.get();
+     *
+     *     std::cout << user.username() << std::endl;
+     *   } catch (const std::exception& exc) {
+     *     std::cerr << "error: " << exc.what() << std::endl;
+     *   }
+     * });
+     * ```
+     *
+     * @param user_id The Discord user ID to fetch from.
+     * @param callback The callback function to call when get_user_view completes.
+     * @note For its C++20 coroutine counterpart, see co_get_user_view.
+     * @see topgg::result
+     * @see topgg::user_view
+     * @see topgg::client::get_user
+     * @see topgg::client::co_get_user_view
+     * @since 2.1.0
+     */
+    void get_user_view(const dpp::snowflake user_id, get_user_view_completion_t callback);
+
+#ifdef DPP_CORO
+    /**
+     * @brief Fetches a user from a Discord ID as a view over the retained response body through a C++20 coroutine.
+     *
+     * @param user_id The Discord user ID to fetch from.
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return co_await to retrieve a topgg::user_view if successful
+     * @note For its C++17 callback-based counterpart, see get_user_view.
+     * @see topgg::async_result
+     * @see topgg::user_view
+     * @see topgg::client::get_user_view
+     * @since 2.1.0
+     */
+    topgg::async_result<topgg::user_view> co_get_user_view(const dpp::snowflake user_id);
+
+    /**
+     * @brief The lazy counterpart of co_get_user_view, which only sends the request once it's awaited.
+     *
+     * @param user_id The Discord user ID to fetch from.
+     * @return co_await to retrieve a topgg::user_view if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_get_user_view
+     * @since 2.1.0
+     */
+    topgg::lazy_result<topgg::user_view> co_get_user_view_lazy(const dpp::snowflake user_id);
 #endif
 
     /**
@@ -360,7 +753,7 @@ namespace topgg {
      * @see topgg::client::co_get_stats
      * @since 2.0.0
      */
-    void get_stats(const get_stats_completion_t& callback);
+    void get_stats(get_stats_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -394,6 +787,16 @@ namespace topgg {
      * @since 2.0.0
      */
     topgg::async_result<topgg::stats> co_get_stats();
+
+    /**
+     * @brief The lazy counterpart of co_get_stats, which only sends the request once it's awaited.
+     *
+     * @return co_await to retrieve a topgg::stats if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_get_stats
+     * @since 2.1.0
+     */
+    topgg::lazy_result<topgg::stats> co_get_stats_lazy();
 #endif
 
     /**
@@ -405,9 +808,9 @@ namespace topgg {
      * dpp::cluster bot{"your bot token"};
      * topgg::client topgg_client{bot, "your top.gg token"};
      *
-     * topgg_client.get_voters([](const auto& result) {
+     * topgg_client.get_voters([](auto& result) {
      *   try {
-     *     auto voters = result.get();
+     *     const auto voters = result.take();
      *
      *     for (auto& voter: voters) {
      *       std::cout << voter.username << std::endl;
@@ -427,7 +830,7 @@ namespace topgg {
      * @see topgg::client::co_get_voters
      * @since 2.0.0
      */
-    void get_voters(const get_voters_completion_t& callback);
+    void get_voters(get_voters_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -465,6 +868,16 @@ namespace topgg {
      * @since 2.0.0
      */
     topgg::async_result<std::vector<voter>> co_get_voters();
+
+    /**
+     * @brief The lazy counterpart of co_get_voters, which only sends the request once it's awaited.
+     *
+     * @return co_await to retrieve a std::vector<voter> if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_get_voters
+     * @since 2.1.0
+     */
+    topgg::lazy_result<std::vector<voter>> co_get_voters_lazy();
 #endif
 
     /**
@@ -496,7 +909,7 @@ namespace topgg {
      * @note For its C++20 coroutine counterpart, see co_has_voted.
      * @since 2.0.0
      */
-    void has_voted(const dpp::snowflake user_id, const has_voted_completion_t& callback);
+    void has_voted(const dpp::snowflake user_id, has_voted_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -534,6 +947,17 @@ namespace topgg {
      * @since 2.0.0
      */
     topgg::async_result<bool> co_has_voted(const dpp::snowflake user_id);
+
+    /**
+     * @brief The lazy counterpart of co_has_voted, which only sends the request once it's awaited.
+     *
+     * @param user_id The Discord user ID to check from.
+     * @return co_await to retrieve a bool if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_has_voted
+     * @since 2.1.0
+     */
+    topgg::lazy_result<bool> co_has_voted_lazy(const dpp::snowflake user_id);
 #endif
 
     /**
@@ -562,7 +986,7 @@ namespace topgg {
      * @see topgg::client::co_is_weekend
      * @since 2.0.0
      */
-    void is_weekend(const is_weekend_completion_t& callback);
+    void is_weekend(is_weekend_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -597,6 +1021,16 @@ namespace topgg {
      * @since 2.0.0
      */
     topgg::async_result<bool> co_is_weekend();
+
+    /**
+     * @brief The lazy counterpart of co_is_weekend, which only sends the request once it's awaited.
+     *
+     * @return co_await to retrieve a bool if successful
+     * @see topgg::lazy_result
+     * @see topgg::client::co_is_weekend
+     * @since 2.1.0
+     */
+    topgg::lazy_result<bool> co_is_weekend_lazy();
 #endif
 
     /**
@@ -622,7 +1056,7 @@ namespace topgg {
      * @see topgg::client::co_post_stats
      * @since 2.0.0
      */
-    void post_stats(const post_stats_completion_t& callback);
+    void post_stats(post_stats_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -642,7 +1076,7 @@ namespace topgg {
      * ```
      *
      * @return co_await to retrieve a bool
-     * @note For its C++17 callback-based counterpart, see post_stats.
+     * @note For its C++17 callback-based counterpart, see post_stats. This returns a dpp::async rather than a topgg::async_result, since posting reports failure as false instead of as an error to throw.
      * @see topgg::client::start_autoposter
      * @see topgg::client::post_stats
      * @since 2.0.0
@@ -677,7 +1111,7 @@ namespace topgg {
      * @see topgg::client::co_post_stats
      * @since 2.0.0
      */
-    void post_stats(const stats& s, const post_stats_completion_t& callback);
+    void post_stats(const stats& s, post_stats_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -699,7 +1133,7 @@ namespace topgg {
      *
      * @param s Your Discord bot's statistics.
      * @return co_await to retrieve a bool
-     * @note For its C++17 callback-based counterpart, see post_stats.
+     * @note For its C++17 callback-based counterpart, see post_stats. This returns a dpp::async rather than a topgg::async_result, since posting reports failure as false instead of as an error to throw.
      * @see topgg::stats
      * @see topgg::client::start_autoposter
      * @see topgg::client::post_stats
@@ -720,14 +1154,40 @@ namespace topgg {
      * bot.start_autoposter();
      * ```
      *
-     * @param delay The minimum delay between post requests in seconds. Defaults to 30 minutes.
+     * @param delay The delay between server count checks in seconds. Defaults to 30 minutes.
      * @throw std::invalid_argument Throws if the delay argument is shorter than 15 minutes.
      * @note This function has no effect if the autoposter is already running.
+     * @note Since 2.1.0, the server count is only posted when it has changed since the last successful post, and failed posts are retried. See topgg::autoposter_options.
      * @see topgg::client::post_stats
      * @see topgg::client::stop_autoposter
      * @since 2.0.0
      */
     void start_autoposter(const time_t delay = 1800);
+
+    /**
+     * @brief Starts autoposting statistics using data directly from your D++ cluster instance.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg::autoposter_options options{};
+     * options.threshold = 10;
+     *
+     * topgg_client.start_autoposter(options);
+     * ```
+     *
+     * @param options The autoposter's tuning options.
+     * @throw std::invalid_argument Throws if the options' delay is shorter than 15 minutes or if its retry delay isn't positive.
+     * @note This function has no effect if the autoposter is already running.
+     * @see topgg::autoposter_options
+     * @see topgg::client::get_autoposter_metrics
+     * @see topgg::client::stop_autoposter
+     * @since 2.1.0
+     */
+    void start_autoposter(const autoposter_options& options);
     
     /**
      * @brief Starts autoposting statistics.
@@ -744,15 +1204,48 @@ namespace topgg {
      * ```
      *
      * @param callback The callback function that returns the current stats.
-     * @param delay The minimum delay between post requests in seconds. Defaults to 30 minutes.
+     * @param delay The delay between server count checks in seconds. Defaults to 30 minutes.
      * @throw std::invalid_argument Throws if the delay argument is shorter than 15 minutes.
      * @note This function has no effect if the autoposter is already running.
+     * @note Since 2.1.0, the server count is only posted when it has changed since the last successful post, and failed posts are retried. See topgg::autoposter_options.
      * @see topgg::stats
      * @see topgg::client::post_stats
      * @see topgg::client::stop_autoposter
      * @since 2.0.0
      */
     void start_autoposter(const custom_autopost_callback_t& callback, const time_t delay = 1800);
+
+    /**
+     * @brief Starts autoposting statistics.
+     *
+     * The callback is called on every check, but the returned stats are only posted once the server count has moved by at least the options' threshold since the last successful post.
+     * Failed posts are retried with an exponential backoff, honoring Top.gg's retry_after on ratelimits.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg::autoposter_options options{};
+     * options.threshold = 10;
+     *
+     * topgg_client.start_autoposter([](dpp::cluster& bot_inner) {
+     *   return topgg::stats{...};
+     * }, options);
+     * ```
+     *
+     * @param callback The callback function that returns the current stats.
+     * @param options The autoposter's tuning options.
+     * @throw std::invalid_argument Throws if the options' delay is shorter than 15 minutes or if its retry delay isn't positive.
+     * @note This function has no effect if the autoposter is already running.
+     * @see topgg::stats
+     * @see topgg::autoposter_options
+     * @see topgg::client::get_autoposter_metrics
+     * @see topgg::client::stop_autoposter
+     * @since 2.1.0
+     */
+    void start_autoposter(const custom_autopost_callback_t& callback, const autoposter_options& options);
     
     /**
      * @brief Prematurely stops the autoposter. Calling this function is usually unnecessary as this function is called later in the destructor.
@@ -775,12 +1268,108 @@ namespace topgg {
      * @since 2.0.0
      */
     void stop_autoposter() noexcept;
+
+    /**
+     * @brief Returns a snapshot of the autoposter's counters. The counters keep accumulating across restarts of the autoposter.
+     *
+     * Example:
+     *
+     * ```cpp
+     * const auto metrics{topgg_client.get_autoposter_metrics()};
+     *
+     * std::cout << metrics.posted << " posted, " << metrics.skipped << " skipped, " << metrics.failed << " failed" << std::endl;
+     * ```
+     *
+     * @return autoposter_metrics A snapshot of the autoposter's counters.
+     * @see topgg::client::start_autoposter
+     * @since 2.1.0
+     */
+    autoposter_metrics get_autoposter_metrics() const noexcept;
+
+    /**
+     * @brief Starts polling your Discord bot's voters and calls the callback once for every newly seen vote.
+     *
+     * This is an alternative to webhooks for deployments that can't expose a public HTTP endpoint.
+     * The first poll only records a snapshot of the current voters, every poll after that diffs the new snapshot against the previous one.
+     * The polling interval adapts to the observed vote rate, polling more often when votes come in quickly and backing off when there are none.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg_client.start_vote_detector([](const auto& voter) {
+     *   std::cout << voter.username << " just voted!" << std::endl;
+     * });
+     * ```
+     *
+     * @param callback The callback function to call for every new vote.
+     * @param min_delay The minimum delay between polls in seconds. Defaults to 1 minute.
+     * @param max_delay The maximum delay between polls in seconds. Defaults to 15 minutes.
+     * @throw std::invalid_argument Throws if the min_delay argument is shorter than 1 minute or longer than max_delay.
+     * @note This function has no effect if the vote detector is already running.
+     * @note Since Top.gg only returns your Discord bot's last 1000 voters, a user that votes again while their previous vote is still in that list won't be detected.
+     * @see topgg::voter
+     * @see topgg::client::get_voters
+     * @see topgg::client::stop_vote_detector
+     * @since 2.1.0
+     */
+    void start_vote_detector(const vote_detected_callback_t& callback, const time_t min_delay = 60, const time_t max_delay = 900);
+
+    /**
+     * @brief Prematurely stops the vote detector. Calling this function is usually unnecessary as this function is called later in the destructor.
+     *
+     * @note This function has no effect if the vote detector is already stopped.
+     * @see topgg::client::start_vote_detector
+     * @since 2.1.0
+     */
+    void stop_vote_detector() noexcept;
     
     /**
-     * @brief The destructor. Stops the autoposter if it's running.
+     * @brief Returns the unix timestamp of when this client's Top.gg ratelimit is lifted.
+     *
+     * While this client is ratelimited, requests fail right away with topgg::ratelimited instead of being sent.
+     *
+     * @return time_t The unix timestamp of when this client's Top.gg ratelimit is lifted, or zero if it was never ratelimited.
+     * @since 2.1.0
+     */
+    inline time_t ratelimited_until() const noexcept {
+      return m_ratelimited_until->load(std::memory_order_relaxed);
+    }
+
+#ifndef _WIN32
+    /**
+     * @brief Makes has_voted and get_user look up and store their responses in a cache shared with other processes on this host.
+     *
+     * Example:
+     *
+     * ```cpp
+     * topgg::shared_cache cache{"/topgg-cache"};
+     *
+     * topgg_client.set_shared_cache(&cache, 264811613708746752);
+     * ```
+     *
+     * @param cache The shared cache to use, or nullptr to stop using one.
+     * @param bot_id The ID of the Discord bot this client's token belongs to. Cached has_voted responses are only shared between clients of the same bot.
+     * @note The shared cache must outlive this client and every request still in flight. Unlike responses from Top.gg, which complete on D++'s threads, cache hits complete synchronously before has_voted or get_user returns.
+     * @see topgg::shared_cache
+     * @since 2.1.0
+     */
+    inline void set_shared_cache(shared_cache* cache, const dpp::snowflake bot_id) noexcept {
+      m_cache = cache;
+      m_cache_bot_id = bot_id;
+    }
+#endif
+
+    /**
+     * @brief The destructor. Stops the autoposter and the vote detector if they're running.
      */
     ~client();
 
     friend class bot_query;
+    friend class compiled_bot_query;
+    friend class multi_client;
+    friend class internal_test_access;
   };
 }; // namespace topgg
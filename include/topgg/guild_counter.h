@@ -0,0 +1,98 @@
+/**
+ * @module topgg
+ * @file guild_counter.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#include <atomic>
+#include <array>
+
+namespace topgg {
+  /**
+   * @brief Keeps a running count of your Discord bot's servers by listening to guild create and delete events.
+   *
+   * Unlike topgg::stats's cluster constructor, reading the count does not walk every shard. Each shard is counted in its own cache line, and the total is kept in an atomic of its own, so reading it is O(1) and lock-free.
+   * A shard's count is reset whenever it becomes ready, since Discord sends every one of its guilds again afterwards.
+   *
+   * Example:
+   *
+   * ```cpp
+   * dpp::cluster bot{"your bot token"};
+   * topgg::client topgg_client{bot, "your top.gg token"};
+   * topgg::guild_counter counter{bot};
+   *
+   * topgg_client.start_autoposter([&counter](TOPGG_UNUSED dpp::cluster& bot_inner) {
+   *   return topgg::stats{counter};
+   * });
+   * ```
+   *
+   * @note The counter must be created before the cluster starts, otherwise guilds that were already received are missed.
+   * @note Guilds that become unavailable during an outage aren't counted until they become available again.
+   * @see topgg::stats
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT guild_counter {
+    static constexpr size_t SHARDS_PER_BLOCK = 64;
+    static constexpr size_t MAX_BLOCKS = 256;
+
+    struct alignas(64) shard_slot {
+      std::atomic<size_t> count{};
+    };
+
+    dpp::cluster& m_cluster;
+    std::array<std::atomic<shard_slot*>, MAX_BLOCKS> m_blocks;
+    alignas(64) std::atomic<size_t> m_total;
+    dpp::event_handle m_create_handle;
+    dpp::event_handle m_delete_handle;
+    dpp::event_handle m_ready_handle;
+
+    shard_slot* slot(const uint32_t shard_id) noexcept;
+    void add(const uint32_t shard_id) noexcept;
+    void remove(const uint32_t shard_id) noexcept;
+    void reset(const uint32_t shard_id) noexcept;
+
+  public:
+    /**
+     * @brief Starts counting the guilds of a D++ cluster.
+     *
+     * @param cluster The D++ cluster instance. Must outlive this counter.
+     * @since 2.1.0
+     */
+    explicit guild_counter(dpp::cluster& cluster);
+
+    guild_counter(const guild_counter&) = delete;
+    guild_counter& operator=(const guild_counter&) = delete;
+
+    /**
+     * @brief Returns the amount of servers your Discord bot is currently in.
+     *
+     * @return size_t The amount of servers your Discord bot is currently in.
+     * @since 2.1.0
+     */
+    inline size_t total() const noexcept {
+      return m_total.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the amount of servers a specific shard is currently in.
+     *
+     * @param shard_id The shard's ID.
+     * @return size_t The amount of servers the shard is currently in, or zero if it's unknown.
+     * @since 2.1.0
+     */
+    size_t shard(const uint32_t shard_id) const noexcept;
+
+    /**
+     * @brief The destructor. Stops listening to the cluster's events.
+     */
+    ~guild_counter();
+  };
+}; // namespace topgg
@@ -0,0 +1,183 @@
+/**
+ * @module topgg
+ * @file leaderboard.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#include <optional>
+#include <vector>
+#include <mutex>
+
+namespace topgg {
+  /**
+   * @brief A single row of a vote leaderboard.
+   *
+   * @see topgg::leaderboard::top
+   * @since 2.1.0
+   */
+  struct leaderboard_entry {
+    /**
+     * @brief The ID of the user.
+     *
+     * @since 2.1.0
+     */
+    dpp::snowflake user_id;
+
+    /**
+     * @brief The amount of votes this user has in the current window.
+     *
+     * @since 2.1.0
+     */
+    size_t votes;
+
+    /**
+     * @brief This user's rank, starting from one. Users with the same amount of votes share the same rank.
+     *
+     * @since 2.1.0
+     */
+    size_t rank;
+  };
+
+  /**
+   * @brief Counts votes per user and answers top-K and rank queries without sorting.
+   *
+   * Users are kept in an open-addressing hash map keyed by their ID, and are grouped in buckets by their vote count. A Fenwick tree over the bucket sizes answers order-statistics queries.
+   * Recording a vote and looking up a user's votes take O(1) time, finding a user's rank takes O(log V) time, and listing the top K users takes O(K log V) time, where V is the highest vote count.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::leaderboard votes{};
+   *
+   * topgg_client.start_vote_detector([&votes](const auto& voter) {
+   *   votes.ingest(voter);
+   * });
+   *
+   * // ...
+   *
+   * for (const auto& entry: votes.top(10)) {
+   *   std::cout << "#" << entry.rank << " " << entry.user_id << ": " << entry.votes << std::endl;
+   * }
+   * ```
+   *
+   * @note Users with the same amount of votes are listed in the order they reached it.
+   * @see topgg::client::start_vote_detector
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT leaderboard {
+    struct slot {
+      uint64_t key;
+      uint32_t index;
+      uint32_t epoch;
+    };
+
+    struct user_entry {
+      uint64_t id;
+      size_t votes;
+      uint32_t previous;
+      uint32_t next;
+    };
+
+    mutable std::mutex m_mutex;
+    std::vector<slot> m_slots;
+    std::vector<user_entry> m_users;
+    std::vector<uint32_t> m_heads;
+    std::vector<uint32_t> m_tails;
+    std::vector<size_t> m_bucket_sizes;
+    std::vector<size_t> m_tree;
+    size_t m_highest;
+    uint32_t m_epoch;
+    time_t m_window;
+    time_t m_window_end;
+
+    const slot* find_slot(const uint64_t id) const noexcept;
+    uint32_t find_or_insert(const uint64_t id);
+    void grow_slots();
+    void grow_buckets(const size_t votes);
+    void tree_add(size_t votes, const size_t amount, const bool remove) noexcept;
+    size_t tree_prefix(size_t votes) const noexcept;
+    size_t tree_find(size_t users) const noexcept;
+    void unlink(const uint32_t index) noexcept;
+    void link(const uint32_t index) noexcept;
+    void reset_locked() noexcept;
+
+  public:
+    /**
+     * @brief Constructs an empty leaderboard.
+     *
+     * @param window The length of a voting window in seconds, after which every count is reset. Windows are aligned to the unix epoch, e.g. 86400 resets the leaderboard every day at midnight UTC. Defaults to zero, which disables automatic resets.
+     * @throw std::invalid_argument Throws if the window is negative.
+     * @since 2.1.0
+     */
+    explicit leaderboard(const time_t window = 0);
+
+    /**
+     * @brief Records votes from a user.
+     *
+     * @param user_id The ID of the user who voted.
+     * @param timestamp The unix timestamp of the vote, used for automatic resets. Defaults to now.
+     * @param votes The amount of votes to record, e.g. two for votes cast on weekends. Defaults to one.
+     * @note Votes whose timestamp falls before the current window are ignored.
+     * @since 2.1.0
+     */
+    void ingest(const dpp::snowflake user_id, const time_t timestamp = time(nullptr), const size_t votes = 1);
+
+    /**
+     * @brief Records a vote from a voter, e.g. one found by the vote detector.
+     *
+     * @param v The voter.
+     * @since 2.1.0
+     */
+    void ingest(const voter& v);
+
+    /**
+     * @brief Returns the amount of votes a user has in the current window.
+     *
+     * @param user_id The ID of the user.
+     * @return size_t The amount of votes the user has, or zero if they haven't voted.
+     * @since 2.1.0
+     */
+    size_t votes(const dpp::snowflake user_id) const noexcept;
+
+    /**
+     * @brief Returns a user's rank in the current window.
+     *
+     * @param user_id The ID of the user.
+     * @return std::optional<size_t> The user's rank starting from one, or std::nullopt if they haven't voted.
+     * @since 2.1.0
+     */
+    std::optional<size_t> rank(const dpp::snowflake user_id) const noexcept;
+
+    /**
+     * @brief Lists the users with the most votes in the current window.
+     *
+     * @param k The maximum amount of users to list.
+     * @return std::vector<leaderboard_entry> The users with the most votes, highest first.
+     * @since 2.1.0
+     */
+    std::vector<leaderboard_entry> top(const size_t k) const;
+
+    /**
+     * @brief Returns the amount of users that voted in the current window.
+     *
+     * @return size_t The amount of users that voted in the current window.
+     * @since 2.1.0
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Resets every count right away. Useful for calendar windows, e.g. when Top.gg resets monthly votes.
+     *
+     * @since 2.1.0
+     */
+    void reset() noexcept;
+  };
+}; // namespace topgg
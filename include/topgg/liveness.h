@@ -0,0 +1,79 @@
+/**
+ * @module topgg
+ * @file liveness.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace topgg {
+  /**
+   * @brief Lets D++ timer callbacks capture `this` without outliving the object that started them.
+   *
+   * Stopping a D++ timer doesn't wait for a tick that's already running on another thread. Callbacks wrapped by guard only run while the object is alive, and end() waits for a running callback to return before the object's members are torn down.
+   *
+   * @note The guarded object mustn't be destroyed from inside one of its own guarded callbacks.
+   * @since 2.1.0
+   */
+  class internal_liveness {
+    struct state {
+      std::mutex mutex;
+      bool alive{true};
+    };
+
+    std::shared_ptr<state> m_state;
+
+  public:
+    inline internal_liveness()
+      : m_state(std::make_shared<state>()) {}
+
+    internal_liveness(const internal_liveness&) = delete;
+    internal_liveness& operator=(const internal_liveness&) = delete;
+
+    /**
+     * @brief Wraps a callback so that it's skipped once end was called.
+     *
+     * @param callback The callback to wrap.
+     * @return auto The wrapped callback, taking the same arguments.
+     * @since 2.1.0
+     */
+    template<typename F>
+    inline auto guard(F&& callback) const {
+      return [state = m_state, callback_in = std::forward<F>(callback)](auto&&... args) {
+        std::lock_guard lock{state->mutex};
+
+        if (state->alive) {
+          callback_in(std::forward<decltype(args)>(args)...);
+        }
+      };
+    }
+
+    /**
+     * @brief Waits for a running guarded callback to return, and stops every guarded callback from running afterwards.
+     *
+     * @since 2.1.0
+     */
+    inline void end() noexcept {
+      std::lock_guard lock{m_state->mutex};
+
+      m_state->alive = false;
+    }
+
+    /**
+     * @brief The destructor. Calls end.
+     */
+    inline ~internal_liveness() {
+      end();
+    }
+  };
+}; // namespace topgg
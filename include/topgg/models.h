@@ -12,19 +12,20 @@
 
 #include <topgg/topgg.h>
 
-#include <string>
+#include <initializer_list>
+#include <memory_resource>
 #include <optional>
+#include <chrono>
+#include <string_view>
 #include <string>
+#include <memory>
 #include <vector>
-
-#if !defined(_WIN32) && !defined(_XOPEN_SOURCE)
-#define _XOPEN_SOURCE
-#endif
-
 #include <ctime>
 
-#ifdef _XOPEN_SOURCE
-#undef _XOPEN_SOURCE
+#ifdef TOPGG_LEAN_MODELS
+#define TOPGG_MODEL_FLAG : 1
+#else
+#define TOPGG_MODEL_FLAG
 #endif
 
 #define TOPGG_BOT_QUERY_SORT(lib_name, api_name)    \
@@ -39,13 +40,172 @@
     return *this;                                \
   }
 
-#define TOPGG_BOT_QUERY_SEARCH(type, name, ...)  \
+#define TOPGG_BOT_QUERY_SEARCH(type, name)       \
   inline bot_query& name(const type name) {      \
-    add_search(#name, name, __VA_ARGS__);        \
+    add_search(#name, name);                     \
     return *this;                                \
   }
 
 namespace topgg {
+  class bot_batch;
+  class bot_table;
+  class compiled_bot_query;
+
+  /**
+   * @brief Deserializes models straight from a response body through a SAX parser, without building a dpp::json DOM.
+   *
+   * @since 2.1.0
+   */
+  class internal_parser {
+    template<typename T>
+    struct fields;
+
+    template<typename T, typename Container>
+    class reader;
+
+    struct nested_field;
+    struct interned_field;
+    struct table_row;
+    class table_builder;
+
+  public:
+    internal_parser() = delete;
+
+    /**
+     * @brief Deserializes a single model from a JSON object.
+     *
+     * @param body The raw response body.
+     * @throw dpp::json::exception Thrown when the body is not valid JSON.
+     * @throw std::runtime_error Thrown when the model's ID is missing.
+     * @return T The deserialized model.
+     * @since 2.1.0
+     */
+    template<typename T>
+    static T parse(const std::string& body);
+
+    /**
+     * @brief Deserializes a list of models from a JSON array, or from an array inside the root JSON object.
+     *
+     * @param body The raw response body.
+     * @param key The root object's key that holds the array, or nullptr if the root itself is the array.
+     * @throw dpp::json::exception Thrown when the body is not valid JSON.
+     * @throw std::runtime_error Thrown when a model's ID is missing.
+     * @return std::vector<T> The deserialized models.
+     * @since 2.1.0
+     */
+    template<typename T>
+    static std::vector<T> parse_array(const std::string& body, const char* key = nullptr);
+
+    /**
+     * @brief Deserializes a list of models like parse_array, but spreads the elements across a shared worker pool.
+     *
+     * A single structural pass finds where every element begins and ends, then the elements are deserialized in parallel into a pre-sized vector.
+     * Small lists, or a malformed body, are deserialized on the calling thread instead.
+     *
+     * @param body The raw response body.
+     * @param key The root object's key that holds the array, or nullptr if the root itself is the array.
+     * @param threads The amount of threads to deserialize on, including the calling thread. Defaults to 0, which uses one per core.
+     * @throw dpp::json::exception Thrown when the body is not valid JSON.
+     * @throw std::runtime_error Thrown when a model's ID is missing.
+     * @return std::vector<T> The deserialized models, in the same order as the array.
+     * @see topgg::internal_parser::parse_array
+     * @since 2.1.0
+     */
+    template<typename T>
+    static std::vector<T> parse_array_parallel(const std::string& body, const char* key = nullptr, size_t threads = 0);
+
+    /**
+     * @brief Deserializes a list of bots into a single arena-backed batch.
+     *
+     * @param body The raw response body.
+     * @param key The root object's key that holds the array, or nullptr if the root itself is the array.
+     * @throw dpp::json::exception Thrown when the body is not valid JSON.
+     * @throw std::runtime_error Thrown when a bot's ID is missing.
+     * @return bot_batch The deserialized bots.
+     * @since 2.1.0
+     */
+    static bot_batch parse_batch(const std::string& body, const char* key = nullptr);
+
+    /**
+     * @brief Deserializes a list of bots into a columnar table.
+     *
+     * @param body The raw response body.
+     * @param key The root object's key that holds the array, or nullptr if the root itself is the array.
+     * @throw dpp::json::exception Thrown when the body is not valid JSON.
+     * @throw std::runtime_error Thrown when a bot's ID is missing.
+     * @return bot_table The deserialized bots.
+     * @since 2.1.0
+     */
+    static bot_table parse_table(const std::string& body, const char* key = nullptr);
+
+    /**
+     * @brief Indexes a single account object into a view that takes over the response body instead of copying from it.
+     *
+     * @param body The raw response body. It is moved from.
+     * @throw std::runtime_error Thrown when the body is malformed or the account's ID is missing.
+     * @return T The account view.
+     * @since 2.1.0
+     */
+    template<typename T>
+    static T parse_view(std::string& body);
+
+    /**
+     * @brief Indexes a list of bots into views that share the response body.
+     *
+     * @param body The raw response body. It is moved from.
+     * @param key The root object's key that holds the array, or nullptr if the root itself is the array.
+     * @throw std::runtime_error Thrown when the body is malformed or a bot's ID is missing.
+     * @return std::vector<bot_view> The bot views.
+     * @since 2.1.0
+     */
+    static std::vector<bot_view> parse_views(std::string& body, const char* key = nullptr);
+
+    /**
+     * @brief Parses an ISO 8601 UTC timestamp into a unix timestamp, without depending on the locale or the timezone database.
+     *
+     * Fractional seconds are truncated, and Z, +HH:MM, +HHMM or +HH offsets are applied. A missing offset is treated as UTC. Days that don't exist in their month, e.g. 2023-02-29, are treated as malformed.
+     *
+     * @param value The timestamp, e.g. "2017-04-26T18:08:17.125Z".
+     * @return time_t The parsed unix timestamp, or 0 if the timestamp is malformed.
+     * @see topgg::internal_parser::parse_time_point
+     * @since 2.1.0
+     */
+    static time_t parse_timestamp(const std::string_view value) noexcept;
+
+    /**
+     * @brief Parses an ISO 8601 UTC timestamp into a std::chrono time point, keeping its fractional seconds.
+     *
+     * @param value The timestamp, e.g. "2017-04-26T18:08:17.125Z".
+     * @return std::optional<std::chrono::system_clock::time_point> The parsed time point, or std::nullopt if the timestamp is malformed.
+     * @see topgg::internal_parser::parse_timestamp
+     * @since 2.1.0
+     */
+    static std::optional<std::chrono::system_clock::time_point> parse_time_point(const std::string_view value) noexcept;
+
+    /**
+     * @brief Deserializes a model from an already parsed JSON object through its compile-time field table.
+     *
+     * Missing or mistyped fields are left untouched instead of throwing.
+     *
+     * @param j The JSON object.
+     * @param output The model to write into.
+     * @throw std::runtime_error Thrown when the model's ID is missing.
+     * @since 2.1.0
+     */
+    template<typename T>
+    static void deserialize(const dpp::json& j, T& output);
+
+    /**
+     * @brief Serializes a model into a JSON object through its compile-time field table.
+     *
+     * @param input The model to read from.
+     * @return dpp::json The serialized JSON object.
+     * @since 2.1.0
+     */
+    template<typename T>
+    static dpp::json serialize(const T& input);
+  };
+
   /**
    * @brief Base class of the account data stored in the Top.gg API.
    *
@@ -56,17 +216,16 @@ namespace topgg {
    */
   class TOPGG_EXPORT account {
   protected:
+    account() = default;
     account(const dpp::json& j);
 
   public:
-    account() = delete;
-
     /**
      * @brief The account's Discord ID.
      *
      * @since 2.0.0
      */
-    dpp::snowflake id;
+    dpp::snowflake id{};
 
     /**
      * @brief The account's entire Discord avatar URL.
@@ -88,7 +247,7 @@ namespace topgg {
      *
      * @since 2.0.0
      */
-    time_t created_at;
+    time_t created_at{};
   };
 
   class bot_query;
@@ -103,30 +262,32 @@ namespace topgg {
    * @since 2.0.0
    */
   class TOPGG_EXPORT voter: public account {
+    voter() = default;
+
     inline voter(const dpp::json& j)
       : account(j) {}
 
-  public:
-    voter() = delete;
-
+    friend class internal_parser;
     friend class client;
   };
 
   /**
    * @brief Represents a Discord bot listed on Top.gg.
    *
+   * @note Since 2.1.0, a field missing from Top.gg's response is left empty or zero instead of failing the whole response. Only a missing ID is still an error.
    * @see topgg::client::get_bot
    * @see topgg::account
    * @since 2.0.0
    */
   class TOPGG_EXPORT bot: public account {
+    bot() = default;
     bot(const dpp::json& j);
 
   public:
-    bot() = delete;
-
+#ifndef TOPGG_LEAN_MODELS
     [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be '0'.")]]
     std::string discriminator;
+#endif
 
     /**
      * @brief The Discord bot's command prefix.
@@ -178,71 +339,570 @@ namespace topgg {
      */
     std::vector<dpp::snowflake> owners;
 
+#ifndef TOPGG_LEAN_MODELS
     [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be an empty vector.")]]
     std::vector<size_t> guilds;
+#endif
 
     /**
      * @brief The Discord bot's page banner URL, if available.
      *
-     * @since 2.0.0
+     * @since 2.0.0
+     */
+    std::optional<std::string> banner;
+
+    /**
+     * @brief The unix timestamp of when this Discord bot was approved on Top.gg by a Bot Reviewer.
+     *
+     * @since 2.0.0
+     */
+    time_t approved_at{};
+
+#ifndef TOPGG_LEAN_MODELS
+    [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be false.")]]
+    bool is_certified{};
+
+    [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be an empty vector.")]]
+    std::vector<size_t> shards;
+#endif
+
+    /**
+     * @brief The amount of upvotes this Discord bot has.
+     *
+     * @since 2.0.0
+     */
+    size_t votes{};
+
+    /**
+     * @brief The amount of upvotes this Discord bot has this month.
+     *
+     * @since 2.0.0
+     */
+    size_t monthly_votes{};
+
+    /**
+     * @brief The Discord bot's support server invite URL, if available.
+     *
+     * @since 2.0.0
+     */
+    std::optional<std::string> support;
+
+#ifndef TOPGG_LEAN_MODELS
+    [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be 0.")]]
+    size_t shard_count{};
+#endif
+
+    /**
+     * @brief The invite URL of this Discord bot.
+     *
+     * @since 2.0.0
+     */
+    std::string invite;
+
+    /**
+     * @brief The URL of this Discord bot's Top.gg page.
+     *
+     * @since 2.0.0
+     */
+    std::string url;
+
+    friend class internal_parser;
+    friend class bot_query;
+    friend class client;
+  };
+
+  /**
+   * @brief Represents a Discord bot listed on Top.gg whose data lives in the arena of a topgg::bot_batch.
+   *
+   * @note Unlike topgg::bot, unavailable optional strings are represented as empty strings. This object must not outlive the topgg::bot_batch it belongs to.
+   * @see topgg::bot_batch
+   * @see topgg::bot
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT batch_bot {
+  public:
+    /**
+     * @brief The allocator used by this bot's strings and vectors.
+     *
+     * @since 2.1.0
+     */
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    /**
+     * @brief Constructs an empty bot that allocates from the specified allocator.
+     *
+     * @param alloc The allocator to use.
+     * @since 2.1.0
+     */
+    explicit batch_bot(const allocator_type& alloc);
+
+    /**
+     * @brief Moves another bot into storage allocated from the specified allocator.
+     *
+     * @param other Other object to move from.
+     * @param alloc The allocator to use.
+     * @since 2.1.0
+     */
+    batch_bot(batch_bot&& other, const allocator_type& alloc);
+
+    /**
+     * @brief Moves data from another object.
+     *
+     * @param other Other object to move from.
+     * @since 2.1.0
+     */
+    batch_bot(batch_bot&& other) noexcept = default;
+
+    /**
+     * @brief The Discord bot's ID.
+     *
+     * @since 2.1.0
+     */
+    dpp::snowflake id;
+
+    /**
+     * @brief The Discord bot's entire Discord avatar URL.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string avatar;
+
+    /**
+     * @brief The Discord bot's username.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string username;
+
+    /**
+     * @brief The unix timestamp of when this Discord bot was created.
+     *
+     * @since 2.1.0
+     */
+    time_t created_at;
+
+    /**
+     * @brief The Discord bot's command prefix.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string prefix;
+
+    /**
+     * @brief The Discord bot's short description.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string short_description;
+
+    /**
+     * @brief The Discord bot's long description, or an empty string if unavailable.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string long_description;
+
+    /**
+     * @brief A list of the Discord bot's tags. Tags are interned, so identical tags across the batch share the same storage.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::vector<std::string_view> tags;
+
+    /**
+     * @brief A link to the Discord bot's website, or an empty string if unavailable.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string website;
+
+    /**
+     * @brief A link to the Discord bot's GitHub repository, or an empty string if unavailable.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string github;
+
+    /**
+     * @brief A list of the Discord bot's owners, represented in Discord user IDs.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::vector<dpp::snowflake> owners;
+
+    /**
+     * @brief The Discord bot's page banner URL, or an empty string if unavailable.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string banner;
+
+    /**
+     * @brief The unix timestamp of when this Discord bot was approved on Top.gg by a Bot Reviewer.
+     *
+     * @since 2.1.0
+     */
+    time_t approved_at;
+
+    /**
+     * @brief The amount of upvotes this Discord bot has.
+     *
+     * @since 2.1.0
+     */
+    size_t votes;
+
+    /**
+     * @brief The amount of upvotes this Discord bot has this month.
+     *
+     * @since 2.1.0
+     */
+    size_t monthly_votes;
+
+    /**
+     * @brief The Discord bot's support server invite URL, or an empty string if unavailable.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string support;
+
+    /**
+     * @brief The invite URL of this Discord bot.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string invite;
+
+    /**
+     * @brief The URL of this Discord bot's Top.gg page.
+     *
+     * @since 2.1.0
+     */
+    std::pmr::string url;
+  };
+
+  /**
+   * @brief A list of Discord bots that share one monotonic arena.
+   *
+   * Every string and vector of every bot in this batch is allocated from the same arena, and repeated tags are interned.
+   * Destroying the batch releases all of them at once.
+   *
+   * @see topgg::bot_query::finish_batch
+   * @see topgg::batch_bot
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT bot_batch {
+    class arena;
+
+    std::unique_ptr<arena> m_arena;
+    std::pmr::vector<batch_bot> m_bots;
+
+    bot_batch(const size_t initial_size);
+
+  public:
+    bot_batch() = delete;
+
+    /**
+     * @brief This object can't be copied.
+     *
+     * @param other Other object to copy from.
+     * @since 2.1.0
+     */
+    bot_batch(const bot_batch& other) = delete;
+
+    /**
+     * @brief Moves data from another object.
+     *
+     * @param other Other object to move from.
+     * @since 2.1.0
+     */
+    bot_batch(bot_batch&& other) noexcept;
+
+    /**
+     * @brief This object can't be copied.
+     *
+     * @param other Other object to copy from.
+     * @return bot_batch The current modified object.
+     * @since 2.1.0
+     */
+    bot_batch& operator=(const bot_batch& other) = delete;
+
+    /**
+     * @brief This object can't be reassigned, as its bots would outlive their arena.
+     *
+     * @param other Other object to move from.
+     * @return bot_batch The current modified object.
+     * @since 2.1.0
+     */
+    bot_batch& operator=(bot_batch&& other) = delete;
+
+    /**
+     * @brief The destructor. Releases the entire arena at once.
+     */
+    ~bot_batch();
+
+    /**
+     * @brief Returns an iterator to the first bot.
+     *
+     * @return std::pmr::vector<batch_bot>::const_iterator An iterator to the first bot.
+     * @since 2.1.0
+     */
+    inline std::pmr::vector<batch_bot>::const_iterator begin() const noexcept {
+      return m_bots.begin();
+    }
+
+    /**
+     * @brief Returns an iterator past the last bot.
+     *
+     * @return std::pmr::vector<batch_bot>::const_iterator An iterator past the last bot.
+     * @since 2.1.0
+     */
+    inline std::pmr::vector<batch_bot>::const_iterator end() const noexcept {
+      return m_bots.end();
+    }
+
+    /**
+     * @brief Returns the bot at the specified index.
+     *
+     * @param index The bot's index.
+     * @return const batch_bot& The bot at the specified index.
+     * @since 2.1.0
+     */
+    inline const batch_bot& operator[](const size_t index) const noexcept {
+      return m_bots[index];
+    }
+
+    /**
+     * @brief Returns the amount of bots in this batch.
+     *
+     * @return size_t The amount of bots in this batch.
+     * @since 2.1.0
+     */
+    inline size_t size() const noexcept {
+      return m_bots.size();
+    }
+
+    /**
+     * @brief Returns whether this batch has no bots.
+     *
+     * @return bool Whether this batch has no bots.
+     * @since 2.1.0
+     */
+    inline bool empty() const noexcept {
+      return m_bots.empty();
+    }
+
+    /**
+     * @brief Returns the amount of unique tags across the bots in this batch.
+     *
+     * @return size_t The amount of unique tags.
+     * @since 2.1.0
+     */
+    size_t unique_tags() const noexcept;
+
+    friend class internal_parser;
+  };
+
+  /**
+   * @brief A struct-of-arrays view of a list of Discord bots for analytics over large listings.
+   *
+   * Every numeric field is stored in its own contiguous column, and tags are dictionary-encoded, so scans only touch the memory they need.
+   * Rows are identified by their index, which is the same across every column.
+   *
+   * @see topgg::bot_query::finish_table
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT bot_table {
+    std::vector<dpp::snowflake> m_ids;
+    std::vector<std::string> m_usernames;
+    std::vector<size_t> m_votes;
+    std::vector<size_t> m_monthly_votes;
+    std::vector<time_t> m_approved_at;
+    std::vector<std::string> m_tag_dictionary;
+    std::vector<uint32_t> m_tag_offsets;
+    std::vector<uint32_t> m_tag_codes;
+    std::vector<uint32_t> m_tag_rows;
+
+    bot_table();
+
+    template<typename C>
+    std::vector<uint32_t> filter_at_least(const std::vector<C>& column, const C min) const;
+
+    std::vector<uint32_t> top(const std::vector<size_t>& column, const size_t k) const;
+
+  public:
+    /**
+     * @brief Returns the amount of rows in this table.
+     *
+     * @return size_t The amount of rows in this table.
+     * @since 2.1.0
+     */
+    inline size_t size() const noexcept {
+      return m_ids.size();
+    }
+
+    /**
+     * @brief Returns whether this table has no rows.
+     *
+     * @return bool Whether this table has no rows.
+     * @since 2.1.0
+     */
+    inline bool empty() const noexcept {
+      return m_ids.empty();
+    }
+
+    /**
+     * @brief Returns the column of Discord bot IDs.
+     *
+     * @return const std::vector<dpp::snowflake>& The column of Discord bot IDs.
+     * @since 2.1.0
+     */
+    inline const std::vector<dpp::snowflake>& ids() const noexcept {
+      return m_ids;
+    }
+
+    /**
+     * @brief Returns the column of Discord bot usernames.
+     *
+     * @return const std::vector<std::string>& The column of Discord bot usernames.
+     * @since 2.1.0
+     */
+    inline const std::vector<std::string>& usernames() const noexcept {
+      return m_usernames;
+    }
+
+    /**
+     * @brief Returns the column of vote counts.
+     *
+     * @return const std::vector<size_t>& The column of vote counts.
+     * @since 2.1.0
+     */
+    inline const std::vector<size_t>& votes() const noexcept {
+      return m_votes;
+    }
+
+    /**
+     * @brief Returns the column of monthly vote counts.
+     *
+     * @return const std::vector<size_t>& The column of monthly vote counts.
+     * @since 2.1.0
+     */
+    inline const std::vector<size_t>& monthly_votes() const noexcept {
+      return m_monthly_votes;
+    }
+
+    /**
+     * @brief Returns the column of approval unix timestamps.
+     *
+     * @return const std::vector<time_t>& The column of approval unix timestamps.
+     * @since 2.1.0
+     */
+    inline const std::vector<time_t>& approved_at() const noexcept {
+      return m_approved_at;
+    }
+
+    /**
+     * @brief Returns every unique tag in this table. A tag's code is its index in this dictionary.
+     *
+     * @return const std::vector<std::string>& Every unique tag in this table.
+     * @since 2.1.0
+     */
+    inline const std::vector<std::string>& tag_dictionary() const noexcept {
+      return m_tag_dictionary;
+    }
+
+    /**
+     * @brief Returns the tags of the specified row.
+     *
+     * @param row The row's index.
+     * @throw std::out_of_range If the row is not in this table.
+     * @return std::vector<std::string_view> The tags of the specified row, without repeats.
+     * @since 2.1.0
+     */
+    std::vector<std::string_view> tags(const uint32_t row) const;
+
+    /**
+     * @brief Returns the sum of every row's vote count.
+     *
+     * @return uint64_t The sum of every row's vote count.
+     * @since 2.1.0
+     */
+    uint64_t total_votes() const noexcept;
+
+    /**
+     * @brief Returns the sum of every row's monthly vote count.
+     *
+     * @return uint64_t The sum of every row's monthly vote count.
+     * @since 2.1.0
      */
-    std::optional<std::string> banner;
+    uint64_t total_monthly_votes() const noexcept;
 
     /**
-     * @brief The unix timestamp of when this Discord bot was approved on Top.gg by a Bot Reviewer.
+     * @brief Returns the rows that have at least the specified amount of votes.
      *
-     * @since 2.0.0
+     * @param min The minimum amount of votes.
+     * @return std::vector<uint32_t> The matching rows, in ascending order.
+     * @since 2.1.0
      */
-    time_t approved_at;
-
-    [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be false.")]]
-    bool is_certified;
-
-    [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be an empty vector.")]]
-    std::vector<size_t> shards;
+    std::vector<uint32_t> filter_votes(const size_t min) const;
 
     /**
-     * @brief The amount of upvotes this Discord bot has.
+     * @brief Returns the rows that have at least the specified amount of monthly votes.
      *
-     * @since 2.0.0
+     * @param min The minimum amount of monthly votes.
+     * @return std::vector<uint32_t> The matching rows, in ascending order.
+     * @since 2.1.0
      */
-    size_t votes;
+    std::vector<uint32_t> filter_monthly_votes(const size_t min) const;
 
     /**
-     * @brief The amount of upvotes this Discord bot has this month.
+     * @brief Returns the rows that were approved within the specified time range.
      *
-     * @since 2.0.0
+     * @param from The inclusive lower bound unix timestamp.
+     * @param to The exclusive upper bound unix timestamp.
+     * @return std::vector<uint32_t> The matching rows, in ascending order.
+     * @since 2.1.0
      */
-    size_t monthly_votes;
+    std::vector<uint32_t> filter_approved_between(const time_t from, const time_t to) const;
 
     /**
-     * @brief The Discord bot's support server invite URL, if available.
+     * @brief Returns the rows that have the specified tag.
      *
-     * @since 2.0.0
+     * @param tag The tag to look for.
+     * @return std::vector<uint32_t> The matching rows, in ascending order. A row is only returned once, even if Top.gg lists its tag twice.
+     * @since 2.1.0
      */
-    std::optional<std::string> support;
-
-    [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be 0.")]]
-    size_t shard_count;
+    std::vector<uint32_t> filter_tag(const std::string_view tag) const;
 
     /**
-     * @brief The invite URL of this Discord bot.
+     * @brief Returns the rows with the highest vote counts.
      *
-     * @since 2.0.0
+     * @param k The maximum amount of rows to return.
+     * @return std::vector<uint32_t> The matching rows, sorted by their vote count in descending order.
+     * @since 2.1.0
      */
-    std::string invite;
+    std::vector<uint32_t> top_votes(const size_t k) const;
 
     /**
-     * @brief The URL of this Discord bot's Top.gg page.
+     * @brief Returns the rows with the highest monthly vote counts.
      *
-     * @since 2.0.0
+     * @param k The maximum amount of rows to return.
+     * @return std::vector<uint32_t> The matching rows, sorted by their monthly vote count in descending order.
+     * @since 2.1.0
      */
-    std::string url;
+    std::vector<uint32_t> top_monthly_votes(const size_t k) const;
 
-    friend class bot_query;
-    friend class client;
+    friend class internal_parser;
   };
 
+  /**
+   * @brief The callback function to call when finish_table completes.
+   *
+   * @see topgg::bot_query::finish_table
+   * @see topgg::bot_table
+   * @since 2.1.0
+   */
+  using get_bots_table_completion_t = std::function<void(result<bot_table>&)>;
+
   /**
    * @brief The callback function to call when get_bots completes.
    *
@@ -250,7 +910,60 @@ namespace topgg {
    * @see topgg::bot_query
    * @since 2.0.1
    */
-  using get_bots_completion_t = std::function<void(const result<std::vector<bot>>&)>;
+  using get_bots_completion_t = std::function<void(result<std::vector<bot>>&)>;
+
+  /**
+   * @brief The callback function to call when finish_batch completes.
+   *
+   * @see topgg::bot_query::finish_batch
+   * @see topgg::bot_batch
+   * @since 2.1.0
+   */
+  using get_bots_batch_completion_t = std::function<void(result<bot_batch>&)>;
+
+  /**
+   * @brief A search field that is left as a parameter slot when compiling a bot_query.
+   *
+   * @see topgg::bot_query::compile
+   * @see topgg::compiled_bot_query
+   * @since 2.1.0
+   */
+  enum class bot_search_field: uint8_t {
+    /**
+     * @brief The bot's username.
+     *
+     * @since 2.1.0
+     */
+    username,
+
+    /**
+     * @brief The bot's prefix.
+     *
+     * @since 2.1.0
+     */
+    prefix,
+
+    /**
+     * @brief The bot's vote count.
+     *
+     * @since 2.1.0
+     */
+    votes,
+
+    /**
+     * @brief The bot's monthly vote count.
+     *
+     * @since 2.1.0
+     */
+    monthly_votes,
+
+    /**
+     * @brief The bot's vanity URL.
+     *
+     * @since 2.1.0
+     */
+    vanity
+  };
 
   /**
    * @brief A class for configuring the query in get_bots before being sent to the Top.gg API.
@@ -263,8 +976,11 @@ namespace topgg {
     std::string m_query;
     std::string m_search;
     const char* m_sort;
+    bool m_parallel;
   
-    inline bot_query(client* c): m_client(c), m_query("/bots?"), m_sort(nullptr) {}
+    inline bot_query(client* c): m_client(c), m_query("/bots?"), m_sort(nullptr), m_parallel(false) {}
+
+    std::string finish_query() const;
     
     void add_query(const char* key, const uint16_t value, const uint16_t max);
     void add_query(const char* key, const char* value);
@@ -321,6 +1037,21 @@ namespace topgg {
      */
     TOPGG_BOT_QUERY_QUERY(uint16_t, skip, 499);
 
+    /**
+     * @brief Deserializes the results of finish on a shared worker pool, which lowers the latency of large pages on multi-core machines.
+     *
+     * @param enabled Whether to deserialize the results in parallel. Defaults to true.
+     * @return bot_query The current modified object.
+     * @note The pool is a process-wide static shared by every client. Its threads are only started the first time a page is deserialized in parallel, and then live until the process exits.
+     * @see topgg::bot_query::finish
+     * @see topgg::internal_parser::parse_array_parallel
+     * @since 2.1.0
+     */
+    inline bot_query& parallel(const bool enabled = true) noexcept {
+      m_parallel = enabled;
+      return *this;
+    }
+
     /**
      * @brief Queries only Discord bots that has this username.
      * 
@@ -370,6 +1101,42 @@ namespace topgg {
      * @since 2.0.1
      */
     TOPGG_BOT_QUERY_SEARCH(std::string&, vanity);
+
+    /**
+     * @brief Compiles this query into an immutable query that can be sent many times.
+     *
+     * Everything configured so far is encoded once. The skip value and the search fields listed in slots are supplied on every send instead.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * const auto query = topgg_client
+     *   .get_bots()
+     *   .limit(50)
+     *   .sort_by_monthly_votes()
+     *   .compile({topgg::bot_search_field::username});
+     *
+     * query.finish([](auto& result) {
+     *   try {
+     *     for (const auto& topgg_bot: result.get()) {
+     *       std::cout << topgg_bot.username << std::endl;
+     *     }
+     *   } catch (const std::exception& exc) {
+     *     std::cerr << "error: " << exc.what() << std::endl;
+     *   }
+     * }, 50, {"shiro"});
+     * ```
+     *
+     * @param slots The search fields that are supplied on every send, in order.
+     * @return compiled_bot_query The compiled query.
+     * @note A skip value set before compiling is dropped, as the skip value is supplied on every send.
+     * @see topgg::compiled_bot_query
+     * @since 2.1.0
+     */
+    compiled_bot_query compile(std::initializer_list<bot_search_field> slots = {}) const;
     
     /**
      * @brief Sends the query to the Top.gg API.
@@ -405,7 +1172,7 @@ namespace topgg {
      * @see topgg::bot_query::co_finish
      * @since 2.0.1
      */
-    void finish(const get_bots_completion_t& callback);
+    void finish(get_bots_completion_t callback);
 
 #ifdef DPP_CORO
     /**
@@ -446,11 +1213,288 @@ namespace topgg {
      * @since 2.0.1
      */
     topgg::async_result<std::vector<topgg::bot>> co_finish();
+
+    /**
+     * @brief The lazy counterpart of co_finish, which only sends the request once it's awaited.
+     *
+     * @return co_await to retrieve a vector of topgg::bot if successful
+     * @see topgg::lazy_result
+     * @see topgg::bot_query::co_finish
+     * @since 2.1.0
+     */
+    topgg::lazy_result<std::vector<topgg::bot>> co_finish_lazy();
+#endif
+
+    /**
+     * @brief Sends the query to the Top.gg API, deserializing every bot into a single arena-backed batch.
+     *
+     * This is cheaper than finish for large queries, as the bots share one allocation and repeated tags are only stored once.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg_client
+     *   .get_bots()
+     *   .limit(500)
+     *   .finish_batch([](auto& result) {
+     *     try {
+     *       const auto bots = result.take();
+     *
+     *       for (const auto& bot: bots) {
+     *         std::cout << bot.username << std::endl;
+     *       }
+     *     } catch (const std::exception& exc) {
+     *       std::cerr << "error: " << exc.what() << std::endl;
+     *     }
+     *   });
+     * ```
+     *
+     * @param callback The callback function to call when finish_batch completes.
+     * @note For its C++20 coroutine counterpart, see co_finish_batch.
+     * @see topgg::bot_batch
+     * @see topgg::bot_query::finish
+     * @see topgg::bot_query::co_finish_batch
+     * @since 2.1.0
+     */
+    void finish_batch(get_bots_batch_completion_t callback);
+
+#ifdef DPP_CORO
+    /**
+     * @brief Sends the query to the Top.gg API through a C++20 coroutine, deserializing every bot into a single arena-backed batch.
+     *
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return co_await to retrieve a topgg::bot_batch if successful
+     * @note For its C++17 callback-based counterpart, see finish_batch.
+     * @see topgg::bot_batch
+     * @see topgg::bot_query::finish_batch
+     * @since 2.1.0
+     */
+    topgg::async_result<topgg::bot_batch> co_finish_batch();
+
+    /**
+     * @brief The lazy counterpart of co_finish_batch, which only sends the request once it's awaited.
+     *
+     * @return co_await to retrieve a topgg::bot_batch if successful
+     * @see topgg::lazy_result
+     * @see topgg::bot_query::co_finish_batch
+     * @since 2.1.0
+     */
+    topgg::lazy_result<topgg::bot_batch> co_finish_batch_lazy();
+#endif
+
+    /**
+     * @brief Sends the query to the Top.gg API, deserializing the bots into a columnar table.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg_client
+     *   .get_bots()
+     *   .limit(500)
+     *   .finish_table([](auto& result) {
+     *     try {
+     *       const auto table = result.take();
+     *
+     *       for (const auto row: table.top_monthly_votes(10)) {
+     *         std::cout << table.usernames()[row] << std::endl;
+     *       }
+     *     } catch (const std::exception& exc) {
+     *       std::cerr << "error: " << exc.what() << std::endl;
+     *     }
+     *   });
+     * ```
+     *
+     * @param callback The callback function to call when finish_table completes.
+     * @note For its C++20 coroutine counterpart, see co_finish_table.
+     * @see topgg::bot_table
+     * @see topgg::bot_query::finish
+     * @see topgg::bot_query::co_finish_table
+     * @since 2.1.0
+     */
+    void finish_table(get_bots_table_completion_t callback);
+
+#ifdef DPP_CORO
+    /**
+     * @brief Sends the query to the Top.gg API through a C++20 coroutine, deserializing the bots into a columnar table.
+     *
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return co_await to retrieve a topgg::bot_table if successful
+     * @note For its C++17 callback-based counterpart, see finish_table.
+     * @see topgg::bot_table
+     * @see topgg::bot_query::finish_table
+     * @since 2.1.0
+     */
+    topgg::async_result<topgg::bot_table> co_finish_table();
+
+    /**
+     * @brief The lazy counterpart of co_finish_table, which only sends the request once it's awaited.
+     *
+     * @return co_await to retrieve a topgg::bot_table if successful
+     * @see topgg::lazy_result
+     * @see topgg::bot_query::co_finish_table
+     * @since 2.1.0
+     */
+    topgg::lazy_result<topgg::bot_table> co_finish_table_lazy();
+#endif
+
+    /**
+     * @brief Sends the query to the Top.gg API, indexing the bots into views over the retained response body.
+     *
+     * Example:
+     *
+     * ```cpp
+     * dpp::cluster bot{"your bot token"};
+     * topgg::client topgg_client{bot, "your top.gg token"};
+     *
+     * topgg_client
+     *   .get_bots()
+     *   .limit(250)
+     *   .finish_views([](auto& result) {
+     *     try {
+     *       for (const auto& topgg_bot: result.get()) {
+     *         std::cout << topgg_bot.username() << " " << topgg_bot.votes() << std::endl;
+     *       }
+     *     } catch (const std::exception& exc) {
+     *       std::cerr << "error: " << exc.what() << std::endl;
+     *     }
+     *   });
+     * ```
+     *
+     * @param callback The callback function to call when finish_views completes.
+     * @note For its C++20 coroutine counterpart, see co_finish_views.
+     * @see topgg::bot_view
+     * @see topgg::bot_query::finish
+     * @see topgg::bot_query::co_finish_views
+     * @since 2.1.0
+     */
+    void finish_views(get_bot_views_completion_t callback);
+
+#ifdef DPP_CORO
+    /**
+     * @brief Sends the query to the Top.gg API through a C++20 coroutine, indexing the bots into views over the retained response body.
+     *
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return co_await to retrieve a std::vector<topgg::bot_view> if successful
+     * @note For its C++17 callback-based counterpart, see finish_views.
+     * @see topgg::bot_view
+     * @see topgg::bot_query::finish_views
+     * @since 2.1.0
+     */
+    topgg::async_result<std::vector<topgg::bot_view>> co_finish_views();
+
+    /**
+     * @brief The lazy counterpart of co_finish_views, which only sends the request once it's awaited.
+     *
+     * @return co_await to retrieve a std::vector<topgg::bot_view> if successful
+     * @see topgg::lazy_result
+     * @see topgg::bot_query::co_finish_views
+     * @since 2.1.0
+     */
+    topgg::lazy_result<std::vector<topgg::bot_view>> co_finish_views_lazy();
 #endif
 
     friend class client;
   };
 
+  /**
+   * @brief An immutable, precompiled get_bots query that can be sent many times.
+   *
+   * The constant parts of the query string are encoded once when compiling. Only the skip value and the search slots are encoded on every send.
+   *
+   * @see topgg::bot_query::compile
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT compiled_bot_query {
+    client* m_client;
+    std::string m_base;
+    std::string m_search;
+    std::vector<bot_search_field> m_slots;
+
+    inline compiled_bot_query(client* c, std::string&& base, std::string&& search, std::vector<bot_search_field>&& slots)
+      : m_client(c), m_base(std::move(base)), m_search(std::move(search)), m_slots(std::move(slots)) {}
+
+  public:
+    compiled_bot_query() = delete;
+
+    /**
+     * @brief Builds the request path for the specified parameters.
+     *
+     * @param skip The amount of bots to be skipped during the query, or 0 to skip none. This cannot be more than 499.
+     * @param values The values of the compiled search slots, in the same order.
+     * @throw std::invalid_argument Thrown when the amount of values doesn't match the amount of search slots.
+     * @return std::string The request path.
+     * @since 2.1.0
+     */
+    std::string path(const uint16_t skip = 0, std::initializer_list<std::string_view> values = {}) const;
+
+    /**
+     * @brief Sends the compiled query to the Top.gg API.
+     *
+     * @param callback The callback function to call when finish completes.
+     * @param skip The amount of bots to be skipped during the query, or 0 to skip none. This cannot be more than 499.
+     * @param values The values of the compiled search slots, in the same order.
+     * @throw std::invalid_argument Thrown when the amount of values doesn't match the amount of search slots.
+     * @note For its C++20 coroutine counterpart, see co_finish.
+     * @see topgg::bot_query::compile
+     * @see topgg::compiled_bot_query::co_finish
+     * @since 2.1.0
+     */
+    void finish(get_bots_completion_t callback, const uint16_t skip = 0, std::initializer_list<std::string_view> values = {}) const;
+
+#ifdef DPP_CORO
+    /**
+     * @brief Sends the compiled query to the Top.gg API through a C++20 coroutine.
+     *
+     * @param skip The amount of bots to be skipped during the query, or 0 to skip none. This cannot be more than 499.
+     * @param values The values of the compiled search slots, in the same order.
+     * @throw std::invalid_argument Thrown when the amount of values doesn't match the amount of search slots.
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return co_await to retrieve a vector of topgg::bot if successful
+     * @note For its C++17 callback-based counterpart, see finish.
+     * @see topgg::bot_query::compile
+     * @see topgg::compiled_bot_query::finish
+     * @since 2.1.0
+     */
+    topgg::async_result<std::vector<topgg::bot>> co_finish(const uint16_t skip = 0, std::initializer_list<std::string_view> values = {}) const;
+
+    /**
+     * @brief The lazy counterpart of co_finish, which only sends the request once it's awaited.
+     *
+     * @param skip The amount of bots to be skipped during the query, or 0 to skip none. This cannot be more than 499.
+     * @param values The values of the compiled search slots, in the same order.
+     * @return co_await to retrieve a vector of topgg::bot if successful
+     * @see topgg::lazy_result
+     * @see topgg::compiled_bot_query::co_finish
+     * @since 2.1.0
+     */
+    topgg::lazy_result<std::vector<topgg::bot>> co_finish_lazy(const uint16_t skip = 0, std::initializer_list<std::string_view> values = {}) const;
+#endif
+
+    friend class bot_query;
+  };
+
   class TOPGG_EXPORT [[deprecated("No longer has a use by Top.gg API v0. Soon, all you need is just your bot's server count.")]] stats {
     stats(const dpp::json& j);
 
@@ -458,6 +1502,8 @@ namespace topgg {
 
     std::string to_json() const;
 
+    friend class internal_parser;
+
   public:
     stats() = delete;
 
@@ -469,6 +1515,26 @@ namespace topgg {
      */
     stats(dpp::cluster& bot);
 
+    /**
+     * @brief Creates a stats object based on a guild counter's running total. Unlike the cluster constructor, this does not walk every shard.
+     *
+     * @param counter The guild counter.
+     * @see topgg::guild_counter
+     * @since 2.1.0
+     */
+    stats(const guild_counter& counter);
+
+#ifndef _WIN32
+    /**
+     * @brief Creates a stats object based on a stats aggregator's summed server count. The server count is unavailable if this process isn't the aggregator's poster.
+     *
+     * @param aggregator The stats aggregator.
+     * @see topgg::stats_aggregator
+     * @since 2.1.0
+     */
+    stats(stats_aggregator& aggregator);
+#endif
+
     /**
      * @brief Creates a stats object based on the bot's server and shard count.
      *
@@ -532,11 +1598,10 @@ namespace topgg {
    * @since 2.0.0
    */
   class TOPGG_EXPORT user_socials {
+    user_socials() = default;
     user_socials(const dpp::json& j);
 
   public:
-    user_socials() = delete;
-
     /**
      * @brief A URL of this user's GitHub account, if available.
      *
@@ -572,12 +1637,14 @@ namespace topgg {
      */
     std::optional<std::string> youtube;
 
+    friend class internal_parser;
     friend class user;
   };
 
   /**
    * @brief Represents a user logged into Top.gg.
    *
+   * @note Since 2.1.0, a field missing from Top.gg's response is left empty or zero instead of failing the whole response. Only a missing ID is still an error.
    * @see topgg::user_socials
    * @see topgg::client::get_user
    * @see topgg::voter
@@ -585,11 +1652,10 @@ namespace topgg {
    * @since 2.0.0
    */
   class TOPGG_EXPORT user: public account {
+    user() = default;
     user(const dpp::json& j);
 
   public:
-    user() = delete;
-
     /**
      * @brief The user's bio, if available.
      *
@@ -616,36 +1682,40 @@ namespace topgg {
      *
      * @since 2.0.0
      */
-    bool is_supporter;
+    bool is_supporter TOPGG_MODEL_FLAG;
 
+#ifndef TOPGG_LEAN_MODELS
     [[deprecated("No longer supported by Top.gg API v0. At the moment, this will always be false.")]]
-    bool is_certified_dev;
+    bool is_certified_dev{};
+#endif
 
     /**
      * @brief Whether this user is a Top.gg moderator or not.
      *
      * @since 2.0.0
      */
-    bool is_moderator;
+    bool is_moderator TOPGG_MODEL_FLAG;
 
     /**
      * @brief Whether this user is a Top.gg website moderator or not.
      *
      * @since 2.0.0
      */
-    bool is_web_moderator;
+    bool is_web_moderator TOPGG_MODEL_FLAG;
 
     /**
      * @brief Whether this user is a Top.gg website administrator or not.
      *
      * @since 2.0.0
      */
-    bool is_admin;
+    bool is_admin TOPGG_MODEL_FLAG;
 
+    friend class internal_parser;
     friend class client;
   };
 }; // namespace topgg
 
+#undef TOPGG_MODEL_FLAG
 #undef TOPGG_BOT_QUERY_SEARCH
 #undef TOPGG_BOT_QUERY_QUERY
 #undef TOPGG_BOT_QUERY_SORT
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @module topgg
+ * @file multi_client.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#include <unordered_map>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <string>
+#include <mutex>
+
+namespace topgg {
+  /**
+   * @brief Manages the clients of several Discord bots from a single process.
+   *
+   * Every client shares the same D++ cluster for its HTTP requests, and a single D++ timer drives every client's autoposter and vote detector, so adding a Discord bot doesn't add a timer.
+   * Each client still keeps its own headers, ratelimit and autoposter state, so one Discord bot getting ratelimited doesn't hold back the others.
+   *
+   * Example:
+   *
+   * ```cpp
+   * dpp::cluster bot{"your bot token"};
+   * topgg::multi_client clients{bot};
+   *
+   * clients.add(first_bot_id, "first top.gg token").start_autoposter([](dpp::cluster& bot_inner) {
+   *   return topgg::stats{...};
+   * });
+   *
+   * clients.add(second_bot_id, "second top.gg token").start_autoposter([](dpp::cluster& bot_inner) {
+   *   return topgg::stats{...};
+   * });
+   * ```
+   *
+   * @note A client must not be removed from inside of one of its own callbacks.
+   * @see topgg::client
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT multi_client {
+    struct task {
+      dpp::timer id;
+      time_t interval;
+      time_t next_run;
+      std::function<void()> callback;
+    };
+
+    dpp::cluster& m_cluster;
+    dpp::timer m_timer;
+    std::recursive_mutex m_mutex;
+    std::unordered_map<dpp::snowflake, std::unique_ptr<client>> m_clients;
+    std::vector<task> m_tasks;
+    dpp::timer m_next_task_id;
+    internal_liveness m_liveness;
+
+    dpp::timer schedule(std::function<void()> callback, const time_t interval);
+    void unschedule(const dpp::timer id) noexcept;
+    void tick();
+
+  public:
+    multi_client() = delete;
+
+    /**
+     * @brief Constructs an empty multi-client.
+     *
+     * @param cluster The D++ cluster instance shared by every client. Must outlive this multi-client.
+     * @since 2.1.0
+     */
+    explicit multi_client(dpp::cluster& cluster);
+
+    multi_client(const multi_client&) = delete;
+    multi_client& operator=(const multi_client&) = delete;
+
+    /**
+     * @brief Adds a client for a Discord bot.
+     *
+     * @param bot_id The Discord bot's ID.
+     * @param token The Discord bot's Top.gg API token.
+     * @throw std::invalid_argument Throws if a client for this Discord bot already exists.
+     * @return client& The newly added client. The reference stays valid until the client is removed.
+     * @since 2.1.0
+     */
+    client& add(const dpp::snowflake bot_id, const std::string& token);
+
+    /**
+     * @brief Finds the client of a Discord bot.
+     *
+     * @param bot_id The Discord bot's ID.
+     * @return client* The Discord bot's client, or nullptr if there is none.
+     * @since 2.1.0
+     */
+    client* find(const dpp::snowflake bot_id);
+
+    /**
+     * @brief Removes and destroys the client of a Discord bot, stopping its autoposter and vote detector.
+     *
+     * @param bot_id The Discord bot's ID.
+     * @return bool Whether a client was removed or not.
+     * @since 2.1.0
+     */
+    bool remove(const dpp::snowflake bot_id);
+
+    /**
+     * @brief Returns the amount of clients.
+     *
+     * @return size_t The amount of clients.
+     * @since 2.1.0
+     */
+    size_t size();
+
+    /**
+     * @brief The destructor. Destroys every client and stops the shared timer.
+     */
+    ~multi_client();
+
+    friend class client;
+  };
+}; // namespace topgg
@@ -0,0 +1,188 @@
+/**
+ * @module topgg
+ * @file reminders.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#include <functional>
+#include <vector>
+#include <array>
+#include <mutex>
+
+namespace topgg {
+  /**
+   * @brief The callback function to call with every batch of users whose reminders are due.
+   *
+   * @see topgg::reminder_scheduler
+   * @since 2.1.0
+   */
+  using reminders_due_callback_t = std::function<void(const std::vector<dpp::snowflake>&)>;
+
+  /**
+   * @brief A handle to a pending reminder, used to cancel it.
+   *
+   * Handles stay safe to use after their reminder fired or was cancelled, cancelling them simply has no effect.
+   *
+   * @see topgg::reminder_scheduler::cancel
+   * @since 2.1.0
+   */
+  struct reminder_handle {
+    /**
+     * @brief The reminder's slot in the scheduler.
+     *
+     * @since 2.1.0
+     */
+    uint32_t index;
+
+    /**
+     * @brief The slot's generation when the reminder was scheduled.
+     *
+     * @since 2.1.0
+     */
+    uint32_t generation;
+  };
+
+  /**
+   * @brief Schedules reminders for users to vote again, for up to millions of users at once.
+   *
+   * Reminders are kept in a hierarchical timing wheel with a one second resolution, driven by a single D++ timer. Scheduling and cancelling a reminder take O(1) time and each pending reminder takes 32 bytes.
+   * Every tick hands all of the reminders that became due to the callback as a single batch.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::reminder_scheduler reminders{bot, [&bot](const auto& users) {
+   *   for (const auto user_id: users) {
+   *     bot.direct_message_create(user_id, dpp::message{"You can vote again!"});
+   *   }
+   * }};
+   *
+   * topgg_client.start_vote_detector([&reminders](const auto& voter) {
+   *   reminders.remind(voter);
+   * });
+   * ```
+   *
+   * @note The callback runs on the D++ timer thread, outside of the scheduler's lock.
+   * @see topgg::client::start_vote_detector
+   * @see topgg::client::has_voted
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT reminder_scheduler {
+    static constexpr size_t LEVELS = 4;
+    static constexpr size_t SLOTS = 256;
+
+    struct node {
+      uint64_t user_id;
+      int64_t deadline;
+      uint32_t previous;
+      uint32_t next;
+      uint32_t generation;
+      uint16_t slot;
+      uint8_t level;
+      bool pending;
+    };
+
+    dpp::cluster& m_cluster;
+    reminders_due_callback_t m_callback;
+    std::mutex m_mutex;
+    std::vector<node> m_nodes;
+    std::array<std::array<uint32_t, SLOTS>, LEVELS> m_wheels;
+    uint32_t m_free;
+    size_t m_size;
+    time_t m_now;
+    dpp::timer m_timer;
+    internal_liveness m_liveness;
+
+    void insert(const uint32_t index, const time_t earliest) noexcept;
+    void unlink(const uint32_t index) noexcept;
+    void cascade(const size_t level, const size_t slot) noexcept;
+    void release(const uint32_t index) noexcept;
+    void advance(const time_t now, std::vector<dpp::snowflake>& due);
+    void tick();
+
+    friend class internal_test_access;
+
+  public:
+    /**
+     * @brief The delay between two votes on Top.gg, in seconds.
+     *
+     * @since 2.1.0
+     */
+    static constexpr time_t VOTE_COOLDOWN = 12 * 60 * 60;
+
+    /**
+     * @brief Constructs an empty reminder scheduler and starts its timer.
+     *
+     * @param cluster The D++ cluster instance that drives the timer. Must outlive this scheduler.
+     * @param callback The callback function to call with every batch of due reminders.
+     * @since 2.1.0
+     */
+    reminder_scheduler(dpp::cluster& cluster, const reminders_due_callback_t& callback);
+
+    reminder_scheduler(const reminder_scheduler&) = delete;
+    reminder_scheduler& operator=(const reminder_scheduler&) = delete;
+
+    /**
+     * @brief Schedules a reminder at a specific time.
+     *
+     * @param user_id The ID of the user to remind.
+     * @param deadline The unix timestamp to remind the user at. Past timestamps are due on the next tick.
+     * @return reminder_handle A handle to the reminder.
+     * @since 2.1.0
+     */
+    reminder_handle schedule(const dpp::snowflake user_id, const time_t deadline);
+
+    /**
+     * @brief Schedules a reminder for when a user can vote again.
+     *
+     * @param user_id The ID of the user who voted.
+     * @param voted_at The unix timestamp of when the user voted. Defaults to now.
+     * @return reminder_handle A handle to the reminder.
+     * @since 2.1.0
+     */
+    inline reminder_handle remind(const dpp::snowflake user_id, const time_t voted_at = time(nullptr)) {
+      return schedule(user_id, voted_at + VOTE_COOLDOWN);
+    }
+
+    /**
+     * @brief Schedules a reminder for when a voter can vote again, e.g. one found by the vote detector.
+     *
+     * @param v The voter.
+     * @return reminder_handle A handle to the reminder.
+     * @since 2.1.0
+     */
+    inline reminder_handle remind(const voter& v) {
+      return remind(v.id);
+    }
+
+    /**
+     * @brief Cancels a pending reminder.
+     *
+     * @param handle The reminder's handle.
+     * @return bool Whether the reminder was still pending or not.
+     * @since 2.1.0
+     */
+    bool cancel(const reminder_handle handle) noexcept;
+
+    /**
+     * @brief Returns the amount of pending reminders.
+     *
+     * @return size_t The amount of pending reminders.
+     * @since 2.1.0
+     */
+    size_t size() noexcept;
+
+    /**
+     * @brief The destructor. Stops the timer, dropping every pending reminder.
+     */
+    ~reminder_scheduler();
+  };
+}; // namespace topgg
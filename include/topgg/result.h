@@ -14,6 +14,9 @@
 
 #include <functional>
 #include <stdexcept>
+#include <exception>
+#include <optional>
+#include <string_view>
 #include <variant>
 #include <utility>
 
@@ -78,20 +81,267 @@ namespace topgg {
     friend class internal_result;
   };
   
+  /**
+   * @brief The category of an error reported by topgg::result::try_get.
+   *
+   * @see topgg::result_error
+   * @since 2.1.0
+   */
+  enum class error_category: uint8_t {
+    /**
+     * @brief An unexpected HTTP exception has occured. See topgg::result_error::http_error.
+     *
+     * @since 2.1.0
+     */
+    http_error,
+
+    /**
+     * @brief The client uses an invalid Top.gg API token.
+     *
+     * @since 2.1.0
+     */
+    invalid_token,
+
+    /**
+     * @brief Such query does not exist.
+     *
+     * @since 2.1.0
+     */
+    not_found,
+
+    /**
+     * @brief The client is ratelimited from sending more HTTP requests. See topgg::result_error::retry_after.
+     *
+     * @since 2.1.0
+     */
+    ratelimited,
+
+    /**
+     * @brief The client received an unexpected error from Top.gg's end.
+     *
+     * @since 2.1.0
+     */
+    internal_server_error,
+
+    /**
+     * @brief The response body could not be parsed.
+     *
+     * @since 2.1.0
+     */
+    parse_error,
+
+    /**
+     * @brief The data has already been moved out of this result.
+     *
+     * @since 2.1.0
+     */
+    consumed
+  };
+
+  /**
+   * @brief Describes why a request failed, without throwing an exception.
+   *
+   * @see topgg::result::try_get
+   * @see topgg::expected
+   * @since 2.1.0
+   */
+  struct TOPGG_EXPORT result_error {
+    /**
+     * @brief The category of this error.
+     *
+     * @since 2.1.0
+     */
+    error_category category;
+
+    /**
+     * @brief The response's HTTP status code, or 0 if there was no response.
+     *
+     * @since 2.1.0
+     */
+    uint16_t status;
+
+    /**
+     * @brief The amount of seconds before the ratelimit is lifted. Only set if the category is error_category::ratelimited.
+     *
+     * @since 2.1.0
+     */
+    uint16_t retry_after;
+
+    /**
+     * @brief The underlying HTTP error. Only set if the category is error_category::http_error.
+     *
+     * @since 2.1.0
+     */
+    dpp::http_error http_error;
+
+    /**
+     * @brief Returns a human-readable description of this error.
+     *
+     * @return const char* A human-readable description of this error.
+     * @since 2.1.0
+     */
+    const char* message() const noexcept;
+  };
+
+  /**
+   * @brief Either the desired data or a topgg::result_error, returned by the non-throwing accessors.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg_client.get_bot(264811613708746752, [](auto& result) {
+   *   const auto topgg_bot = result.try_get();
+   *
+   *   if (topgg_bot) {
+   *     std::cout << topgg_bot->username << std::endl;
+   *   } else if (topgg_bot.error().category == topgg::error_category::ratelimited) {
+   *     std::cerr << "retry in " << topgg_bot.error().retry_after << " seconds" << std::endl;
+   *   }
+   * });
+   * ```
+   *
+   * @see topgg::result::try_get
+   * @since 2.1.0
+   */
+  template<typename T>
+  class expected {
+    std::variant<T, result_error> m_data;
+
+  public:
+    /**
+     * @brief Wraps successfully fetched data.
+     *
+     * @param value The fetched data.
+     * @since 2.1.0
+     */
+    inline expected(T&& value)
+      : m_data(std::in_place_index<0>, std::move(value)) {}
+
+    /**
+     * @brief Wraps an error.
+     *
+     * @param error The error.
+     * @since 2.1.0
+     */
+    inline expected(const result_error& error) noexcept
+      : m_data(std::in_place_index<1>, error) {}
+
+    /**
+     * @brief Returns whether this object contains the desired data.
+     *
+     * @return bool Whether this object contains the desired data.
+     * @since 2.1.0
+     */
+    inline bool has_value() const noexcept {
+      return m_data.index() == 0;
+    }
+
+    /**
+     * @brief Returns whether this object contains the desired data.
+     *
+     * @return bool Whether this object contains the desired data.
+     * @since 2.1.0
+     */
+    inline explicit operator bool() const noexcept {
+      return has_value();
+    }
+
+    /**
+     * @brief Returns the desired data. The behavior is undefined if this object contains an error.
+     *
+     * @return T& The desired data.
+     * @since 2.1.0
+     */
+    inline T& operator*() & noexcept {
+      return *std::get_if<0>(&m_data);
+    }
+
+    /**
+     * @brief Returns the desired data. The behavior is undefined if this object contains an error.
+     *
+     * @return const T& The desired data.
+     * @since 2.1.0
+     */
+    inline const T& operator*() const & noexcept {
+      return *std::get_if<0>(&m_data);
+    }
+
+    /**
+     * @brief Moves the desired data out. The behavior is undefined if this object contains an error.
+     *
+     * @return T&& The desired data.
+     * @since 2.1.0
+     */
+    inline T&& operator*() && noexcept {
+      return std::move(*std::get_if<0>(&m_data));
+    }
+
+    /**
+     * @brief Accesses the desired data's members. The behavior is undefined if this object contains an error.
+     *
+     * @return T* The desired data.
+     * @since 2.1.0
+     */
+    inline T* operator->() noexcept {
+      return std::get_if<0>(&m_data);
+    }
+
+    /**
+     * @brief Accesses the desired data's members. The behavior is undefined if this object contains an error.
+     *
+     * @return const T* The desired data.
+     * @since 2.1.0
+     */
+    inline const T* operator->() const noexcept {
+      return std::get_if<0>(&m_data);
+    }
+
+    /**
+     * @brief Returns the error. The behavior is undefined if this object contains the desired data.
+     *
+     * @return const result_error& The error.
+     * @since 2.1.0
+     */
+    inline const result_error& error() const noexcept {
+      return *std::get_if<1>(&m_data);
+    }
+  };
+
   template<typename T>
   class result;
 
   class TOPGG_EXPORT internal_result {
-    const dpp::http_request_completion_t m_response;
+    std::string m_body;
+    result_error m_failure;
+    bool m_failed;
+
+    void classify() noexcept;
 
     void prepare() const;
 
     inline internal_result(const dpp::http_request_completion_t& response)
-      : m_response(response) {}
+      : m_body(response.body), m_failure{error_category::http_error, static_cast<uint16_t>(response.status), 0, response.error}, m_failed(false) {
+      classify();
+    }
+
+    // only for responses the client owns, such as cache hits, since D++ only lends its responses out
+    inline internal_result(dpp::http_request_completion_t&& response)
+      : m_body(std::move(response.body)), m_failure{error_category::http_error, static_cast<uint16_t>(response.status), 0, response.error}, m_failed(false) {
+      classify();
+    }
 
   public:
     internal_result() = delete;
 
+    /**
+     * @brief Finds the retry_after value of a 429 response body without building a DOM or throwing on malformed bodies.
+     *
+     * @param body The response body.
+     * @return std::optional<uint16_t> The amount of seconds before the ratelimit is lifted, rounded up, or std::nullopt if the body doesn't have one.
+     * @since 2.1.0
+     */
+    static std::optional<uint16_t> find_retry_after(const std::string_view body) noexcept;
+
     template<typename T>
     friend class result;
   };
@@ -102,16 +352,50 @@ namespace topgg {
    * @brief A result class that gets returned from every HTTP response.
    * This class may either contain the desired data or an error.
    *
+   * The response body is parsed lazily the first time the data is requested, and the parsed data or the error is cached afterwards.
+   *
    * @see topgg::async_result
    * @since 2.0.0
    */
   template<typename T>
   class TOPGG_EXPORT result {
-    const internal_result m_internal;
-    const std::function<T(const dpp::json& json)> m_parse_fn;
+    using conversion_fn_t = T (*)(std::string&);
+
+    mutable internal_result m_internal;
+    conversion_fn_t m_parse_fn;
+    mutable std::optional<T> m_value;
+    mutable std::exception_ptr m_parse_error;
+    mutable bool m_resolved;
 
-    inline result(const dpp::http_request_completion_t& response, const std::function<T(const dpp::json&)>& parse_fn)
-      : m_internal(response), m_parse_fn(parse_fn) {}
+    inline result(const dpp::http_request_completion_t& response, const conversion_fn_t parse_fn)
+      : m_internal(response), m_parse_fn(parse_fn), m_resolved(false) {}
+
+    inline result(dpp::http_request_completion_t&& response, const conversion_fn_t parse_fn)
+      : m_internal(std::move(response)), m_parse_fn(parse_fn), m_resolved(false) {}
+
+    void resolve() const noexcept {
+      if (!m_resolved) {
+        m_resolved = true;
+
+        // API and HTTP errors are already known without parsing anything
+        if (!m_internal.m_failed) {
+          try {
+            m_value.emplace(m_parse_fn(m_internal.m_body));
+          } catch (...) {
+            m_parse_error = std::current_exception();
+          }
+        }
+      }
+    }
+
+    void check() const {
+      resolve();
+      m_internal.prepare();
+
+      if (m_parse_error) {
+        std::rethrow_exception(m_parse_error);
+      }
+    }
 
   public:
     result() = delete;
@@ -124,19 +408,168 @@ namespace topgg {
      * @throw topgg::not_found Thrown when such query does not exist.
      * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
      * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
-     * @return T The desired data, if successful.
+     * @return const T& The desired data, if successful.
+     * @note The response body is only parsed once, subsequent calls return the cached data or rethrow the cached error.
+     * @see topgg::result::take
+     * @see topgg::result::try_get
      * @since 2.0.0
      */
-    T get() const {
-      m_internal.prepare();
+    const T& get() const & {
+      check();
+
+      return m_value.value();
+    }
+
+    /**
+     * @brief Tries to move the returned data out of a temporary result.
+     *
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return T The desired data, if successful.
+     * @see topgg::result::take
+     * @since 2.1.0
+     */
+    inline T get() && {
+      return take();
+    }
+
+    /**
+     * @brief Tries to move the returned data out of this result without copying it.
+     *
+     * Example:
+     *
+     * ```cpp
+     * topgg_client.get_voters([](auto& result) {
+     *   try {
+     *     const auto voters = result.take();
+     *
+     *     std::cout << voters.size() << std::endl;
+     *   } catch (const std::exception& exc) {
+     *     std::cerr << "error: " << exc.what() << std::endl;
+     *   }
+     * });
+     * ```
+     *
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return T The desired data, if successful.
+     * @note The data can only be moved out once. Calling get or take after this throws std::bad_optional_access.
+     * @see topgg::result::get
+     * @see topgg::result::try_get
+     * @since 2.1.0
+     */
+    T take() {
+      check();
+
+      T value{std::move(m_value.value())};
+      m_value.reset();
+
+      return value;
+    }
+
+    /**
+     * @brief Moves the returned data out of this result, reporting any error as a value instead of throwing it.
+     *
+     * HTTP and API errors are detected from the response alone, so no exception is thrown or caught for them.
+     *
+     * Example:
+     *
+     * ```cpp
+     * topgg_client.get_voters([](auto& result) {
+     *   const auto voters = result.try_get();
+     *
+     *   if (voters) {
+     *     std::cout << voters->size() << std::endl;
+     *   } else {
+     *     std::cerr << "error: " << voters.error().message() << std::endl;
+     *   }
+     * });
+     * ```
+     *
+     * @return expected<T> The desired data or the reason why it is unavailable.
+     * @note Like take, the data can only be moved out once. Subsequent calls report error_category::consumed.
+     * @see topgg::expected
+     * @see topgg::result::take
+     * @since 2.1.0
+     */
+    expected<T> try_get() {
+      resolve();
+
+      if (m_internal.m_failed) {
+        return expected<T>{m_internal.m_failure};
+      } else if (m_value.has_value()) {
+        expected<T> output{std::move(*m_value)};
+        m_value.reset();
+
+        return output;
+      }
 
-      return m_parse_fn(dpp::json::parse(m_internal.m_response.body));
+      return expected<T>{result_error{m_parse_error ? error_category::parse_error : error_category::consumed, m_internal.m_failure.status, 0, dpp::h_success}};
     }
 
     friend class client;
+    friend class internal_test_access;
   };
 
 #ifdef DPP_CORO
+  /**
+   * @brief The non-throwing counterpart of topgg::async_result, created from topgg::async_result::try_get.
+   *
+   * @see topgg::async_result::try_get
+   * @since 2.1.0
+   */
+  template<typename T>
+  class async_expected {
+    dpp::async<result<T>> m_fut;
+
+    inline async_expected(dpp::async<result<T>>&& fut) noexcept
+      : m_fut(std::move(fut)) {}
+
+  public:
+    async_expected() = delete;
+
+    /**
+     * @brief Checks whether the request already completed, in which case the caller isn't suspended.
+     *
+     * @return bool Whether the request already completed.
+     * @since 2.1.0
+     */
+    inline bool await_ready() {
+      return m_fut.await_ready();
+    }
+
+    /**
+     * @brief Suspends the caller until the request completes.
+     *
+     * @param handle The caller's coroutine handle.
+     * @since 2.1.0
+     */
+    template<typename H>
+    inline decltype(auto) await_suspend(H handle) {
+      return m_fut.await_suspend(handle);
+    }
+
+    /**
+     * @brief Moves the fetched data or the error out of the completed request.
+     *
+     * @return expected<T> The desired data or the reason why it is unavailable.
+     * @see topgg::result::try_get
+     * @since 2.1.0
+     */
+    inline expected<T> await_resume() {
+      return m_fut.await_resume().try_get();
+    }
+
+    template<typename U>
+    friend class async_result;
+  };
+
   /**
    * @brief An async result class that gets returned from every C++20 coroutine HTTP response.
    * This class may either contain the desired data or an error.
@@ -187,41 +620,30 @@ namespace topgg {
      * @since 2.0.0
      */
     async_result& operator=(async_result&& other) noexcept = default;
-  
+
     /**
-     * @brief Suspends the caller and tries to retrieve the fetched data.
+     * @brief Checks whether the request already completed, in which case the caller isn't suspended.
      *
-     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
-     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
-     * @throw topgg::not_found Thrown when such query does not exist.
-     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
-     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
-     * @return T The desired data, if successful.
-     * @see topgg::result::get
-     * @since 2.0.0
+     * @return bool Whether the request already completed.
+     * @since 2.1.0
      */
-    inline T& operator co_await() & {
-      return m_fut.operator co_await().get();
+    inline bool await_ready() {
+      return m_fut.await_ready();
     }
-    
+
     /**
-     * @brief Suspends the caller and tries to retrieve the fetched data.
+     * @brief Suspends the caller until the request completes.
      *
-     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
-     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
-     * @throw topgg::not_found Thrown when such query does not exist.
-     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
-     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
-     * @return T The desired data, if successful.
-     * @see topgg::result::get
-     * @since 2.0.0
+     * @param handle The caller's coroutine handle.
+     * @since 2.1.0
      */
-    inline const T& operator co_await() const & {
-      return m_fut.operator co_await().get();
+    template<typename H>
+    inline decltype(auto) await_suspend(H handle) {
+      return m_fut.await_suspend(handle);
     }
-    
+
     /**
-     * @brief Suspends the caller and tries to retrieve the fetched data.
+     * @brief Moves the fetched data out of the completed request.
      *
      * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
      * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
@@ -229,13 +651,38 @@ namespace topgg {
      * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
      * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
      * @return T The desired data, if successful.
-     * @see topgg::result::get
-     * @since 2.0.0
+     * @see topgg::result::take
+     * @since 2.1.0
      */
-    inline T&& operator co_await() && {
-      return std::forward<dpp::async<result<T>>>(m_fut).operator co_await().get();
+    inline T await_resume() {
+      return m_fut.await_resume().take();
     }
     
+    /**
+     * @brief Awaits the request, reporting any error as a value instead of throwing it.
+     *
+     * Example:
+     *
+     * ```cpp
+     * const auto topgg_bot = co_await topgg_client.co_get_bot(264811613708746752).try_get();
+     *
+     * if (topgg_bot) {
+     *   std::cout << topgg_bot->username << std::endl;
+     * } else {
+     *   std::cerr << "error: " << topgg_bot.error().message() << std::endl;
+     * }
+     * ```
+     *
+     * @return async_expected<T> co_await to retrieve a topgg::expected<T>.
+     * @see topgg::result::try_get
+     * @since 2.1.0
+     */
+    inline async_expected<T> try_get() && noexcept {
+      return async_expected<T>{std::move(m_fut)};
+    }
+
+    friend class bot_query;
+    friend class compiled_bot_query;
     friend class client;
   };
 #endif
@@ -0,0 +1,284 @@
+/**
+ * @module topgg
+ * @file rewards.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <deque>
+#include <mutex>
+#include <map>
+
+namespace topgg {
+  /**
+   * @brief Tuning options for the reward pipeline.
+   *
+   * @see topgg::reward_pipeline
+   * @since 2.1.0
+   */
+  struct reward_options {
+    /**
+     * @brief The maximum amount of role changes in flight for a single server before Discord reported its ratelimit bucket. Defaults to 5.
+     *
+     * @since 2.1.0
+     */
+    size_t burst = 5;
+
+    /**
+     * @brief The maximum amount of role changes sent per second across all servers, kept below Discord's global ratelimit. Defaults to 40.
+     *
+     * @since 2.1.0
+     */
+    size_t global_rate = 40;
+
+    /**
+     * @brief How long a granted role isn't granted again to the same user in seconds. Defaults to 12 hours.
+     *
+     * @since 2.1.0
+     */
+    time_t dedupe_window = 12 * 60 * 60;
+
+    /**
+     * @brief The maximum amount of attempts for a role change that failed because of a connection or server error. Defaults to 3.
+     *
+     * @since 2.1.0
+     */
+    size_t max_attempts = 3;
+  };
+
+  /**
+   * @brief The reward pipeline's counters, sampled at a single point in time.
+   *
+   * @see topgg::reward_pipeline::get_metrics
+   * @since 2.1.0
+   */
+  struct reward_metrics {
+    /**
+     * @brief The amount of roles granted.
+     *
+     * @since 2.1.0
+     */
+    size_t granted;
+
+    /**
+     * @brief The amount of grants dropped because the same role was already queued or recently granted to the same user.
+     *
+     * @since 2.1.0
+     */
+    size_t deduplicated;
+
+    /**
+     * @brief The amount of grants that failed for good, e.g. because the user isn't in the server.
+     *
+     * @since 2.1.0
+     */
+    size_t failed;
+
+    /**
+     * @brief The amount of grants that were requeued after being ratelimited or after a connection or server error.
+     *
+     * @since 2.1.0
+     */
+    size_t retried;
+
+    /**
+     * @brief The amount of grants waiting to be sent.
+     *
+     * @since 2.1.0
+     */
+    size_t backlog;
+
+    /**
+     * @brief The amount of grants sent to Discord and waiting for a response.
+     *
+     * @since 2.1.0
+     */
+    size_t in_flight;
+
+    /**
+     * @brief The amount of servers with grants waiting to be sent.
+     *
+     * @since 2.1.0
+     */
+    size_t guilds;
+
+    /**
+     * @brief The recent amount of roles granted per second, smoothed over roughly the last ten seconds.
+     *
+     * @since 2.1.0
+     */
+    double grants_per_second;
+  };
+
+  /**
+   * @brief Grants Discord roles to voters, paced per server so that large vote bursts don't run into Discord's ratelimits.
+   *
+   * Grants are queued per server and sent by a single D++ timer every second, round-robin across servers. Each server's in-flight grants are capped by the remaining requests Discord reported for its ratelimit bucket, and a server that got ratelimited is paused until its bucket resets. The same role is never queued twice for the same user, and isn't granted again within the dedupe window.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::reward_pipeline rewards{bot};
+   *
+   * rewards.add_reward(264445053596991498, 1026525568344264724);
+   *
+   * topgg_client.start_vote_detector([&rewards](const auto& voter) {
+   *   rewards.grant(voter);
+   * });
+   * ```
+   *
+   * @see topgg::client::start_vote_detector
+   * @see topgg::client::get_voters
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT reward_pipeline {
+    using clock = std::chrono::steady_clock;
+
+    struct grant_key {
+      uint64_t guild_id;
+      uint64_t user_id;
+      uint64_t role_id;
+
+      inline bool operator==(const grant_key& other) const noexcept {
+        return guild_id == other.guild_id && user_id == other.user_id && role_id == other.role_id;
+      }
+    };
+
+    struct grant_key_hash {
+      size_t operator()(const grant_key& key) const noexcept;
+    };
+
+    struct pending_grant {
+      grant_key key;
+      size_t attempts;
+    };
+
+    struct guild_queue {
+      std::deque<pending_grant> grants;
+      size_t in_flight{};
+      size_t remaining{};
+      clock::time_point reset_at{};
+      clock::time_point paused_until{};
+    };
+
+    struct pipeline_state {
+      std::mutex mutex;
+      reward_options options;
+      std::map<uint64_t, guild_queue> guilds;
+      std::unordered_map<grant_key, time_t, grant_key_hash> recent;
+      std::unordered_set<grant_key, grant_key_hash> queued;
+      uint64_t cursor{};
+      size_t backlog{};
+      size_t in_flight{};
+      size_t granted{};
+      size_t deduplicated{};
+      size_t failed{};
+      size_t retried{};
+      size_t last_granted{};
+      double grants_per_second{};
+      time_t last_prune{};
+    };
+
+    dpp::cluster& m_cluster;
+    std::multimap<uint64_t, uint64_t> m_rewards;
+    std::mutex m_rewards_mutex;
+    std::shared_ptr<pipeline_state> m_state;
+    dpp::timer m_timer;
+    internal_liveness m_liveness;
+
+    static void complete(const std::shared_ptr<pipeline_state>& state, const pending_grant& grant, const dpp::confirmation_callback_t& event);
+
+    bool enqueue(const grant_key& key);
+    void tick();
+
+  public:
+    /**
+     * @brief Constructs an empty reward pipeline and starts its timer.
+     *
+     * @param cluster The D++ cluster instance used to grant roles. Must outlive this pipeline.
+     * @param options The pipeline's tuning options.
+     * @throw std::invalid_argument Throws if burst or global_rate is zero.
+     * @since 2.1.0
+     */
+    explicit reward_pipeline(dpp::cluster& cluster, const reward_options& options = {});
+
+    reward_pipeline(const reward_pipeline&) = delete;
+    reward_pipeline& operator=(const reward_pipeline&) = delete;
+
+    /**
+     * @brief Adds a role that every voter gets in a server.
+     *
+     * @param guild_id The server's ID.
+     * @param role_id The role's ID.
+     * @see topgg::reward_pipeline::grant
+     * @since 2.1.0
+     */
+    void add_reward(const dpp::snowflake guild_id, const dpp::snowflake role_id);
+
+    /**
+     * @brief Removes a role previously added with add_reward. Grants already queued are still sent.
+     *
+     * @param guild_id The server's ID.
+     * @param role_id The role's ID.
+     * @return bool Whether the role was a reward or not.
+     * @since 2.1.0
+     */
+    bool remove_reward(const dpp::snowflake guild_id, const dpp::snowflake role_id);
+
+    /**
+     * @brief Queues every reward added with add_reward for a user.
+     *
+     * @param user_id The user's ID.
+     * @return size_t The amount of grants queued, excluding deduplicated ones.
+     * @since 2.1.0
+     */
+    size_t grant(const dpp::snowflake user_id);
+
+    /**
+     * @brief Queues every reward added with add_reward for a voter, e.g. one found by the vote detector.
+     *
+     * @param v The voter.
+     * @return size_t The amount of grants queued, excluding deduplicated ones.
+     * @since 2.1.0
+     */
+    inline size_t grant(const voter& v) {
+      return grant(v.id);
+    }
+
+    /**
+     * @brief Queues a single role for a user in a server.
+     *
+     * @param guild_id The server's ID.
+     * @param user_id The user's ID.
+     * @param role_id The role's ID.
+     * @return bool Whether the grant was queued or deduplicated.
+     * @since 2.1.0
+     */
+    bool grant(const dpp::snowflake guild_id, const dpp::snowflake user_id, const dpp::snowflake role_id);
+
+    /**
+     * @brief Samples the pipeline's counters.
+     *
+     * @return reward_metrics The pipeline's counters.
+     * @since 2.1.0
+     */
+    reward_metrics get_metrics();
+
+    /**
+     * @brief The destructor. Stops the timer and drops every queued grant. Grants already in flight still complete.
+     */
+    ~reward_pipeline();
+  };
+}; // namespace topgg
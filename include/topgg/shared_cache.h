@@ -0,0 +1,118 @@
+/**
+ * @module topgg
+ * @file shared_cache.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#ifndef _WIN32
+
+#include <string>
+
+namespace topgg {
+  /**
+   * @brief Tuning options for the shared cache.
+   *
+   * @see topgg::shared_cache
+   * @since 2.1.0
+   */
+  struct shared_cache_options {
+    /**
+     * @brief The amount of cached responses, rounded up to a power of two. Each one takes 2 KiB of shared memory. Only used by the process that creates the segment. Defaults to 4096.
+     *
+     * @since 2.1.0
+     */
+    size_t capacity = 4096;
+
+    /**
+     * @brief How long has_voted responses stay cached in seconds. Defaults to 1 minute.
+     *
+     * @since 2.1.0
+     */
+    time_t vote_ttl = 60;
+
+    /**
+     * @brief How long get_user responses stay cached in seconds. Defaults to 10 minutes.
+     *
+     * @since 2.1.0
+     */
+    time_t user_ttl = 600;
+  };
+
+  /**
+   * @brief A cache of has_voted and get_user responses in a shared memory segment, shared by every process on the host that opens it.
+   *
+   * The cache is a fixed-size open-addressing table keyed by bot ID, user ID and endpoint. Each entry is guarded by its own sequence lock, so lookups never block and never take a lock.
+   * A process that dies mid-write leaves the entry it was writing locked, until another process finds its owner gone and reclaims it.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::shared_cache cache{"/topgg-cache"};
+   *
+   * topgg_client.set_shared_cache(&cache, 264811613708746752);
+   *
+   * // answered from the cache if another process already asked recently
+   * topgg_client.has_voted(user_id, [](const auto& response) {
+   *   // ...
+   * });
+   * ```
+   *
+   * @note Only available on POSIX systems. Responses bigger than an entry aren't cached. Processes sharing a cache must share a PID namespace, since entries are reclaimed by checking whether their writer's process ID still exists.
+   * @see topgg::client::set_shared_cache
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT shared_cache {
+    static constexpr uint32_t vote_endpoint = 1;
+    static constexpr uint32_t user_endpoint = 2;
+
+    shared_cache_options m_options;
+    unsigned char* m_mapping;
+    size_t m_mapping_size;
+    size_t m_capacity;
+
+    bool find(const dpp::snowflake bot_id, const uint32_t endpoint, const dpp::snowflake id, std::string& out) const;
+    void store(const dpp::snowflake bot_id, const uint32_t endpoint, const dpp::snowflake id, const std::string& body) noexcept;
+
+  public:
+    /**
+     * @brief Opens a shared cache segment, creating it if no other process has yet.
+     *
+     * @param name The shared memory segment's name, starting with a slash, e.g. "/topgg-cache".
+     * @param options The cache's tuning options.
+     * @throw std::invalid_argument Throws if the capacity is zero.
+     * @throw std::runtime_error Throws if the segment can't be opened or isn't a valid cache.
+     * @since 2.1.0
+     */
+    explicit shared_cache(const std::string& name, const shared_cache_options& options = {});
+
+    shared_cache(const shared_cache&) = delete;
+    shared_cache& operator=(const shared_cache&) = delete;
+
+    /**
+     * @brief Removes a shared cache segment's name, so that the next process to open it creates a new one. Processes that already opened it keep using the old one.
+     *
+     * @param name The shared memory segment's name.
+     * @return bool Whether the name was removed or not.
+     * @since 2.1.0
+     */
+    static bool unlink(const std::string& name) noexcept;
+
+    /**
+     * @brief The destructor. Unmaps the segment without removing it.
+     */
+    ~shared_cache();
+
+    friend class client;
+    friend class internal_test_access;
+  };
+}; // namespace topgg
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * @module topgg
+ * @file stats_aggregator.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#ifndef _WIN32
+
+#include <unordered_map>
+#include <functional>
+#include <optional>
+#include <string>
+#include <mutex>
+
+namespace topgg {
+  /**
+   * @brief The callback function that returns the current process's partial server count.
+   *
+   * @see topgg::stats_aggregator
+   * @since 2.1.0
+   */
+  using partial_count_callback_t = std::function<size_t(dpp::cluster&)>;
+
+  /**
+   * @brief Sums the server counts of several processes running on the same host, so that only one of them posts the total.
+   *
+   * Every process periodically reports its partial server count over a Unix datagram socket.
+   * The process that manages to bind the socket path becomes the poster and sums every report it receives. If it goes away, the next process that fails to reach it takes over.
+   * Reports from processes that stopped reporting expire after three intervals.
+   *
+   * Start the autoposter in every process with stats built from the aggregator. Processes that aren't the poster don't have a total, which makes their autoposter skip posting.
+   *
+   * Example:
+   *
+   * ```cpp
+   * dpp::cluster bot{"your bot token", dpp::i_default_intents, total_shards, cluster_id, max_clusters};
+   * topgg::client topgg_client{bot, "your top.gg token"};
+   * topgg::stats_aggregator aggregator{bot, "/tmp/topgg-stats.sock", cluster_id};
+   *
+   * topgg_client.start_autoposter([&aggregator](TOPGG_UNUSED dpp::cluster& bot_inner) {
+   *   return topgg::stats{aggregator};
+   * });
+   * ```
+   *
+   * @note Only available on POSIX systems. Every process must be on the same host and use a unique process ID.
+   * @see topgg::stats
+   * @see topgg::client::start_autoposter
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT stats_aggregator {
+    struct report {
+      size_t count;
+      time_t last_seen;
+    };
+
+    dpp::cluster& m_cluster;
+    std::string m_path;
+    partial_count_callback_t m_callback;
+    time_t m_interval;
+    uint32_t m_process_id;
+    dpp::timer m_timer;
+
+    std::mutex m_mutex;
+    std::unordered_map<uint32_t, report> m_reports;
+    time_t m_leader_since;
+    time_t m_next_report;
+    uint64_t m_path_inode;
+    int m_socket;
+    bool m_leader;
+    internal_liveness m_liveness;
+
+    bool try_lead();
+    void step_down() noexcept;
+    void tick();
+
+  public:
+    /**
+     * @brief Joins the aggregation group behind a socket path.
+     *
+     * @param cluster The D++ cluster instance. Must outlive this aggregator.
+     * @param path The Unix socket path shared by every process in the group.
+     * @param process_id An ID that's unique to this process within the group, e.g. its D++ cluster ID.
+     * @param callback The callback function that returns this process's partial server count. Defaults to the sum of this cluster's shards' guild counts.
+     * @param interval The delay between reports in seconds. Defaults to 15 seconds.
+     * @throw std::invalid_argument Throws if the path is too long or if the interval isn't positive.
+     * @throw std::runtime_error Throws if the socket can't be created.
+     * @since 2.1.0
+     */
+    stats_aggregator(dpp::cluster& cluster, const std::string& path, const uint32_t process_id, const partial_count_callback_t& callback = {}, const time_t interval = 15);
+
+    stats_aggregator(const stats_aggregator&) = delete;
+    stats_aggregator& operator=(const stats_aggregator&) = delete;
+
+    /**
+     * @brief Returns whether this process is currently the poster.
+     *
+     * @return bool Whether this process is currently the poster.
+     * @since 2.1.0
+     */
+    bool is_leader() noexcept;
+
+    /**
+     * @brief Returns the summed server count of every process in the group.
+     *
+     * @return std::optional<size_t> The summed server count, or std::nullopt if this process isn't the poster or hasn't been the poster for long enough to have heard from every process.
+     * @since 2.1.0
+     */
+    std::optional<size_t> total();
+
+    /**
+     * @brief The destructor. Stops reporting and gives up the socket path if this process is the poster.
+     */
+    ~stats_aggregator();
+  };
+}; // namespace topgg
+
+#endif
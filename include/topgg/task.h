@@ -0,0 +1,572 @@
+/**
+ * @module topgg
+ * @file task.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#ifdef DPP_CORO
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <optional>
+#include <utility>
+#include <atomic>
+#include <stdexcept>
+#include <cstddef>
+#include <new>
+
+namespace topgg {
+  template<typename T>
+  class task;
+
+  /**
+   * @brief Recycles coroutine frames on the thread that freed them, so that short-lived coroutines stop going through the global allocator.
+   *
+   * Frames are grouped into 64-byte size classes up to 4 KiB, bigger frames are allocated normally.
+   *
+   * @see topgg::task
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT internal_frame_pool {
+  public:
+    static void* allocate(const size_t size);
+    static void deallocate(void* frame, const size_t size) noexcept;
+  };
+
+  class internal_task_promise_base {
+  protected:
+    std::coroutine_handle<> m_continuation;
+    std::exception_ptr m_exception;
+
+    template<typename T>
+    friend class task;
+
+  public:
+    struct final_awaiter {
+      inline bool await_ready() const noexcept {
+        return false;
+      }
+
+      // resumes the awaiter directly instead of going back through the caller's stack
+      template<typename P>
+      inline std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) const noexcept {
+        const auto continuation{static_cast<internal_task_promise_base&>(handle.promise()).m_continuation};
+
+        return continuation ? continuation : std::noop_coroutine();
+      }
+
+      inline void await_resume() const noexcept {}
+    };
+
+    inline std::suspend_always initial_suspend() const noexcept {
+      return {};
+    }
+
+    inline final_awaiter final_suspend() const noexcept {
+      return {};
+    }
+
+    inline void unhandled_exception() noexcept {
+      m_exception = std::current_exception();
+    }
+
+    inline static void* operator new(const size_t size) {
+      return internal_frame_pool::allocate(size);
+    }
+
+    inline static void operator delete(void* frame, const size_t size) noexcept {
+      internal_frame_pool::deallocate(frame, size);
+    }
+  };
+
+  template<typename T>
+  class internal_task_promise: public internal_task_promise_base {
+    std::optional<T> m_value;
+
+    template<typename U>
+    friend class task;
+
+  public:
+    task<T> get_return_object() noexcept;
+
+    template<typename U>
+    inline void return_value(U&& value) {
+      m_value.emplace(std::forward<U>(value));
+    }
+  };
+
+  template<>
+  class internal_task_promise<void>: public internal_task_promise_base {
+  public:
+    task<void> get_return_object() noexcept;
+
+    inline void return_void() const noexcept {}
+  };
+
+  /**
+   * @brief A lazily started C++20 coroutine whose frame comes from a per-thread recycling pool instead of the global allocator.
+   *
+   * A task only starts running once it's awaited, and resumes its awaiter directly once it finishes. Together with topgg::lazy_result, returned by the co_*_lazy methods, awaiting Top.gg requests from a task doesn't allocate anything besides the request itself.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::task<bool> voted_for_both(topgg::client& first, topgg::client& second, const dpp::snowflake user_id) {
+   *   co_return co_await first.co_has_voted_lazy(user_id) && co_await second.co_has_voted_lazy(user_id);
+   * }
+   *
+   * bot.on_message_create([&](const auto& event) -> dpp::task<void> {
+   *   if (co_await voted_for_both(first, second, event.msg.author.id)) {
+   *     // ...
+   *   }
+   * });
+   * ```
+   *
+   * @note A task that's never awaited never runs. Exceptions thrown inside of a task are rethrown to its awaiter.
+   * @see topgg::lazy_result
+   * @since 2.1.0
+   */
+  template<typename T>
+  class TOPGG_EXPORT task {
+  public:
+    /**
+     * @brief The coroutine's promise type.
+     *
+     * @since 2.1.0
+     */
+    using promise_type = internal_task_promise<T>;
+
+  private:
+    std::coroutine_handle<promise_type> m_handle;
+
+    inline explicit task(const std::coroutine_handle<promise_type> handle) noexcept
+      : m_handle(handle) {}
+
+  public:
+    task() = delete;
+
+    /**
+     * @brief This object can't be copied.
+     *
+     * @param other Other object to copy from.
+     * @since 2.1.0
+     */
+    task(const task& other) = delete;
+
+    /**
+     * @brief Moves data from another object.
+     *
+     * @param other Other object to move from.
+     * @since 2.1.0
+     */
+    inline task(task&& other) noexcept
+      : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+    /**
+     * @brief This object can't be copied.
+     *
+     * @param other Other object to copy from.
+     * @return task The current modified object.
+     * @since 2.1.0
+     */
+    task& operator=(const task& other) = delete;
+
+    /**
+     * @brief Moves data from another object.
+     *
+     * @param other Other object to move from.
+     * @return task The current modified object.
+     * @since 2.1.0
+     */
+    inline task& operator=(task&& other) noexcept {
+      if (this != &other) {
+        if (m_handle) {
+          m_handle.destroy();
+        }
+
+        m_handle = std::exchange(other.m_handle, nullptr);
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Checks whether the task already finished, in which case the caller isn't suspended.
+     *
+     * @return bool Whether the task already finished.
+     * @since 2.1.0
+     */
+    inline bool await_ready() const noexcept {
+      return m_handle.done();
+    }
+
+    /**
+     * @brief Starts the task, which resumes the caller once it finishes.
+     *
+     * @param caller The caller's coroutine handle.
+     * @return std::coroutine_handle<> The task's coroutine handle.
+     * @since 2.1.0
+     */
+    inline std::coroutine_handle<> await_suspend(const std::coroutine_handle<> caller) noexcept {
+      m_handle.promise().m_continuation = caller;
+
+      return m_handle;
+    }
+
+    /**
+     * @brief Moves the task's returned value out of it.
+     *
+     * @throw std::exception Rethrows whatever the task threw.
+     * @return T The task's returned value.
+     * @since 2.1.0
+     */
+    T await_resume() {
+      auto& promise{m_handle.promise()};
+
+      if (promise.m_exception) {
+        std::rethrow_exception(promise.m_exception);
+      }
+
+      if constexpr (!std::is_void_v<T>) {
+        return std::move(*promise.m_value);
+      }
+    }
+
+    /**
+     * @brief The destructor. Frees the task's coroutine frame.
+     */
+    inline ~task() {
+      if (m_handle) {
+        m_handle.destroy();
+      }
+    }
+
+    friend class internal_task_promise<T>;
+  };
+
+  template<typename T>
+  inline task<T> internal_task_promise<T>::get_return_object() noexcept {
+    return task<T>{std::coroutine_handle<internal_task_promise<T>>::from_promise(*this)};
+  }
+
+  inline task<void> internal_task_promise<void>::get_return_object() noexcept {
+    return task<void>{std::coroutine_handle<internal_task_promise<void>>::from_promise(*this)};
+  }
+
+  /**
+   * @brief The completion state shared between a topgg::lazy_result and its request, allocated from internal_frame_pool.
+   *
+   * The request's completion resumes the awaiter only if it's still suspended and wasn't destroyed, and whichever of the two lets go of the state last frees it.
+   *
+   * @since 2.1.0
+   */
+  template<typename T>
+  struct internal_lazy_state {
+    static constexpr uint8_t suspended = 1;
+    static constexpr uint8_t completed = 2;
+    static constexpr uint8_t abandoned = 4;
+
+    std::optional<result<T>> value;
+    std::coroutine_handle<> handle;
+    std::atomic<uint8_t> flags;
+    std::atomic<uint8_t> references;
+
+    inline static internal_lazy_state* create(const std::coroutine_handle<> awaiter) {
+      const auto state{new (internal_frame_pool::allocate(sizeof(internal_lazy_state))) internal_lazy_state{}};
+
+      state->handle = awaiter;
+      state->references.store(2, std::memory_order_relaxed);
+
+      return state;
+    }
+
+    inline void release() noexcept {
+      if (references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        this->~internal_lazy_state();
+        internal_frame_pool::deallocate(this, sizeof(internal_lazy_state));
+      }
+    }
+  };
+
+  template<typename T>
+  class lazy_result;
+
+  /**
+   * @brief The non-throwing counterpart of topgg::lazy_result, created from topgg::lazy_result::try_get.
+   *
+   * @see topgg::lazy_result::try_get
+   * @since 2.1.0
+   */
+  template<typename T>
+  class lazy_expected {
+    lazy_result<T> m_result;
+
+    inline lazy_expected(lazy_result<T>&& result_in) noexcept
+      : m_result(std::move(result_in)) {}
+
+  public:
+    lazy_expected() = delete;
+
+    /**
+     * @brief Always returns false, as the request is only sent once the caller is suspended.
+     *
+     * @return bool Whether the request already completed.
+     * @since 2.1.0
+     */
+    inline bool await_ready() const noexcept {
+      return false;
+    }
+
+    /**
+     * @brief Sends the request and suspends the caller until it completes.
+     *
+     * @param handle The caller's coroutine handle.
+     * @return bool Whether the caller stays suspended, false if the request completed right away.
+     * @since 2.1.0
+     */
+    inline bool await_suspend(const std::coroutine_handle<> handle) {
+      return m_result.await_suspend(handle);
+    }
+
+    /**
+     * @brief Moves the fetched data or the error out of the completed request.
+     *
+     * @return expected<T> The desired data or the reason why it is unavailable.
+     * @see topgg::result::try_get
+     * @since 2.1.0
+     */
+    inline expected<T> await_resume() {
+      return m_result.m_state->value->try_get();
+    }
+
+    friend class lazy_result<T>;
+  };
+
+  /**
+   * @brief The lazy counterpart of topgg::async_result, returned by the co_*_lazy methods.
+   *
+   * Unlike topgg::async_result, which sends its request right away and keeps its completion state in a dpp::async, the request is only sent once the result is awaited, and its completion state comes from the per-thread pool that topgg::task frames come from. Awaiting it doesn't allocate anything on its own once the pool is warm.
+   *
+   * Example:
+   *
+   * ```cpp
+   * const auto voted = co_await topgg_client.co_has_voted_lazy(user_id);
+   * ```
+   *
+   * @note Nothing is sent until the result is awaited, so requests that should run concurrently need to be awaited from separate coroutines, or use topgg::async_result instead. Destroying the awaiting coroutine while it's suspended is safe, in which case the response is dropped.
+   * @see topgg::async_result
+   * @see topgg::task
+   * @since 2.1.0
+   */
+  template<typename T>
+  class TOPGG_EXPORT lazy_result {
+    static constexpr size_t STORAGE_SIZE = 64;
+
+    struct completion {
+      internal_lazy_state<T>* m_state;
+
+      inline void operator()(result<T>& r) const {
+        const auto state{m_state};
+
+        state->value.emplace(std::move(r));
+
+        const auto flags{state->flags.fetch_or(internal_lazy_state<T>::completed, std::memory_order_acq_rel)};
+
+        if ((flags & internal_lazy_state<T>::suspended) != 0 && (flags & internal_lazy_state<T>::abandoned) == 0) {
+          state->handle.resume();
+        }
+
+        state->release();
+      }
+    };
+
+    alignas(std::max_align_t) unsigned char m_storage[STORAGE_SIZE];
+    void (*m_start)(void*, completion);
+    void (*m_relocate)(void*, void*) noexcept;
+    void (*m_destroy)(void*) noexcept;
+    internal_lazy_state<T>* m_state;
+
+    template<class F>
+    inline lazy_result(F&& cb): m_state(nullptr) {
+      using function_t = std::decay_t<F>;
+
+      static_assert(sizeof(function_t) <= STORAGE_SIZE && alignof(function_t) <= alignof(std::max_align_t), "The request's starting function is too large to be stored inline.");
+
+      new (m_storage) function_t(std::forward<F>(cb));
+
+      m_start = [](void* function, completion c) {
+        (*static_cast<function_t*>(function))(std::move(c));
+      };
+
+      m_relocate = [](void* from, void* to) noexcept {
+        new (to) function_t(std::move(*static_cast<function_t*>(from)));
+        static_cast<function_t*>(from)->~function_t();
+      };
+
+      m_destroy = [](void* function) noexcept {
+        static_cast<function_t*>(function)->~function_t();
+      };
+    }
+
+    inline void take_from(lazy_result& other) noexcept {
+      m_start = std::exchange(other.m_start, nullptr);
+      m_relocate = std::exchange(other.m_relocate, nullptr);
+      m_destroy = std::exchange(other.m_destroy, nullptr);
+      m_state = std::exchange(other.m_state, nullptr);
+
+      if (m_relocate != nullptr) {
+        m_relocate(other.m_storage, m_storage);
+      }
+    }
+
+    inline void reset() noexcept {
+      if (m_destroy != nullptr) {
+        m_destroy(m_storage);
+        m_start = nullptr;
+        m_relocate = nullptr;
+        m_destroy = nullptr;
+      }
+
+      // a request that's still in flight frees the state once it completes, without resuming anything
+      if (m_state != nullptr) {
+        m_state->flags.fetch_or(internal_lazy_state<T>::abandoned, std::memory_order_acq_rel);
+        std::exchange(m_state, nullptr)->release();
+      }
+    }
+
+  public:
+    lazy_result() = delete;
+
+    /**
+     * @brief This object can't be copied.
+     *
+     * @param other Other object to copy from.
+     * @since 2.1.0
+     */
+    lazy_result(const lazy_result& other) = delete;
+
+    /**
+     * @brief Moves data from another object.
+     *
+     * @param other Other object to move from.
+     * @note Results can't be moved while they're being awaited.
+     * @since 2.1.0
+     */
+    inline lazy_result(lazy_result&& other) noexcept {
+      take_from(other);
+    }
+
+    /**
+     * @brief This object can't be copied.
+     *
+     * @param other Other object to copy from.
+     * @return lazy_result The current modified object.
+     * @since 2.1.0
+     */
+    lazy_result& operator=(const lazy_result& other) = delete;
+
+    /**
+     * @brief Moves data from another object.
+     *
+     * @param other Other object to move from.
+     * @return lazy_result The current modified object.
+     * @note Results can't be moved while they're being awaited.
+     * @since 2.1.0
+     */
+    inline lazy_result& operator=(lazy_result&& other) noexcept {
+      if (this != &other) {
+        reset();
+        take_from(other);
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Always returns false, as the request is only sent once the caller is suspended.
+     *
+     * @return bool Whether the request already completed.
+     * @since 2.1.0
+     */
+    inline bool await_ready() const noexcept {
+      return false;
+    }
+
+    /**
+     * @brief Sends the request and suspends the caller until it completes.
+     *
+     * @param handle The caller's coroutine handle.
+     * @throw std::logic_error Throws if this result was already awaited.
+     * @return bool Whether the caller stays suspended, false if the request completed right away.
+     * @since 2.1.0
+     */
+    bool await_suspend(const std::coroutine_handle<> handle) {
+      if (m_start == nullptr || m_state != nullptr) {
+        throw std::logic_error{"This result was already awaited."};
+      }
+
+      m_state = internal_lazy_state<T>::create(handle);
+
+      try {
+        m_start(m_storage, completion{m_state});
+      } catch (...) {
+        // the completion won't ever run, so its reference is dropped here
+        m_state->release();
+        throw;
+      }
+
+      // whoever comes second between the completion and this function resumes the caller
+      return (m_state->flags.fetch_or(internal_lazy_state<T>::suspended, std::memory_order_acq_rel) & internal_lazy_state<T>::completed) == 0;
+    }
+
+    /**
+     * @brief Moves the fetched data out of the completed request.
+     *
+     * @throw topgg::internal_server_error Thrown when the client receives an unexpected error from Top.gg's end.
+     * @throw topgg::invalid_token Thrown when its known that the client uses an invalid Top.gg API token.
+     * @throw topgg::not_found Thrown when such query does not exist.
+     * @throw topgg::ratelimited Thrown when the client gets ratelimited from sending more HTTP requests.
+     * @throw dpp::http_error Thrown when an unexpected HTTP exception has occured.
+     * @return T The desired data, if successful.
+     * @see topgg::result::take
+     * @since 2.1.0
+     */
+    inline T await_resume() {
+      return m_state->value->take();
+    }
+
+    /**
+     * @brief Awaits the request, reporting any error as a value instead of throwing it.
+     *
+     * @return lazy_expected<T> co_await to retrieve a topgg::expected<T>.
+     * @see topgg::result::try_get
+     * @since 2.1.0
+     */
+    inline lazy_expected<T> try_get() && noexcept {
+      return lazy_expected<T>{std::move(*this)};
+    }
+
+    /**
+     * @brief The destructor. Drops the request if it was never awaited, and lets an in-flight request free its state once it completes.
+     */
+    inline ~lazy_result() {
+      reset();
+    }
+
+    friend class lazy_expected<T>;
+    friend class bot_query;
+    friend class compiled_bot_query;
+    friend class client;
+  };
+}; // namespace topgg
+
+#endif
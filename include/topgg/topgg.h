@@ -49,5 +49,17 @@
 #endif
 
 #include <topgg/result.h>
+#include <topgg/task.h>
+#include <topgg/liveness.h>
+#include <topgg/views.h>
+#include <topgg/guild_counter.h>
+#include <topgg/stats_aggregator.h>
 #include <topgg/models.h>
-#include <topgg/client.h>
\ No newline at end of file
+#include <topgg/leaderboard.h>
+#include <topgg/reminders.h>
+#include <topgg/rewards.h>
+#include <topgg/client.h>
+#include <topgg/shared_cache.h>
+#include <topgg/multi_client.h>
+#include <topgg/webhook.h>
+#include <topgg/vote_journal.h>
\ No newline at end of file
@@ -0,0 +1,435 @@
+/**
+ * @module topgg
+ * @file views.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#include <functional>
+#include <string_view>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace topgg {
+  class internal_parser;
+  class view_scanner;
+
+  /**
+   * @brief The location of a single string value inside of a retained response body.
+   *
+   * @since 2.1.0
+   */
+  struct view_span {
+    /**
+     * @brief The value's offset from the beginning of the response body.
+     *
+     * @since 2.1.0
+     */
+    uint32_t offset;
+
+    /**
+     * @brief The value's length in bytes.
+     *
+     * @since 2.1.0
+     */
+    uint32_t length;
+  };
+
+  /**
+   * @brief A read-only view of a Top.gg account that keeps its response body alive instead of copying from it.
+   *
+   * String fields are returned as std::string_views pointing into the retained response body, which is shared by every view created from the same response.
+   * An empty std::string_view means that the field is unavailable.
+   *
+   * @see topgg::bot_view
+   * @see topgg::user_view
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT account_view {
+  protected:
+    std::shared_ptr<const std::string> m_body;
+    dpp::snowflake m_id;
+    view_span m_username;
+    view_span m_avatar;
+
+    account_view() noexcept;
+
+    inline std::string_view at(const view_span span) const noexcept {
+      return span.length == 0 ? std::string_view{} : std::string_view{m_body->data() + span.offset, span.length};
+    }
+
+  public:
+    /**
+     * @brief Returns the account's Discord ID.
+     *
+     * @return dpp::snowflake The account's Discord ID.
+     * @since 2.1.0
+     */
+    inline dpp::snowflake id() const noexcept {
+      return m_id;
+    }
+
+    /**
+     * @brief Returns the account's username.
+     *
+     * @return std::string_view The account's username.
+     * @since 2.1.0
+     */
+    inline std::string_view username() const noexcept {
+      return at(m_username);
+    }
+
+    /**
+     * @brief Builds the account's avatar URL.
+     *
+     * @return std::string The account's avatar URL.
+     * @since 2.1.0
+     */
+    std::string avatar() const;
+
+    /**
+     * @brief Returns the unix timestamp of when this account was created.
+     *
+     * @return time_t The unix timestamp of when this account was created.
+     * @since 2.1.0
+     */
+    inline time_t created_at() const noexcept {
+      return static_cast<time_t>(((m_id >> 22) / 1000) + 1420070400);
+    }
+
+    friend class view_scanner;
+  };
+
+  /**
+   * @brief A read-only view of a Discord bot listed on Top.gg.
+   *
+   * Derived URLs such as avatar(), invite(), support() and url() are only built when accessed.
+   *
+   * @see topgg::account_view
+   * @see topgg::client::get_bot_view
+   * @see topgg::bot_query::finish_views
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT bot_view: public account_view {
+    view_span m_prefix;
+    view_span m_short_description;
+    view_span m_long_description;
+    view_span m_website;
+    view_span m_github;
+    view_span m_owners;
+    view_span m_banner;
+    view_span m_approved_at;
+    view_span m_support;
+    view_span m_invite;
+    view_span m_vanity;
+    std::vector<view_span> m_tags;
+    size_t m_votes;
+    size_t m_monthly_votes;
+
+    bot_view() noexcept;
+
+  public:
+    /**
+     * @brief Returns the Discord bot's command prefix.
+     *
+     * @return std::string_view The Discord bot's command prefix.
+     * @since 2.1.0
+     */
+    inline std::string_view prefix() const noexcept {
+      return at(m_prefix);
+    }
+
+    /**
+     * @brief Returns the Discord bot's short description.
+     *
+     * @return std::string_view The Discord bot's short description.
+     * @since 2.1.0
+     */
+    inline std::string_view short_description() const noexcept {
+      return at(m_short_description);
+    }
+
+    /**
+     * @brief Returns the Discord bot's HTML/Markdown long description.
+     *
+     * @return std::string_view The Discord bot's HTML/Markdown long description.
+     * @since 2.1.0
+     */
+    inline std::string_view long_description() const noexcept {
+      return at(m_long_description);
+    }
+
+    /**
+     * @brief Returns the Discord bot's tags.
+     *
+     * @return std::vector<std::string_view> The Discord bot's tags.
+     * @since 2.1.0
+     */
+    std::vector<std::string_view> tags() const;
+
+    /**
+     * @brief Returns the Discord bot's website URL.
+     *
+     * @return std::string_view The Discord bot's website URL.
+     * @since 2.1.0
+     */
+    inline std::string_view website() const noexcept {
+      return at(m_website);
+    }
+
+    /**
+     * @brief Returns the Discord bot's GitHub repository URL.
+     *
+     * @return std::string_view The Discord bot's GitHub repository URL.
+     * @since 2.1.0
+     */
+    inline std::string_view github() const noexcept {
+      return at(m_github);
+    }
+
+    /**
+     * @brief Parses the Discord bot's owner IDs.
+     *
+     * @return std::vector<dpp::snowflake> The Discord bot's owner IDs.
+     * @since 2.1.0
+     */
+    std::vector<dpp::snowflake> owners() const;
+
+    /**
+     * @brief Returns the Discord bot's page banner URL.
+     *
+     * @return std::string_view The Discord bot's page banner URL.
+     * @since 2.1.0
+     */
+    inline std::string_view banner() const noexcept {
+      return at(m_banner);
+    }
+
+    /**
+     * @brief Parses the unix timestamp of when this Discord bot was approved on Top.gg by a Bot Reviewer.
+     *
+     * @return time_t The unix timestamp of when this Discord bot was approved on Top.gg by a Bot Reviewer.
+     * @since 2.1.0
+     */
+    time_t approved_at() const;
+
+    /**
+     * @brief Returns the amount of upvotes this Discord bot has.
+     *
+     * @return size_t The amount of upvotes this Discord bot has.
+     * @since 2.1.0
+     */
+    inline size_t votes() const noexcept {
+      return m_votes;
+    }
+
+    /**
+     * @brief Returns the amount of upvotes this Discord bot has this month.
+     *
+     * @return size_t The amount of upvotes this Discord bot has this month.
+     * @since 2.1.0
+     */
+    inline size_t monthly_votes() const noexcept {
+      return m_monthly_votes;
+    }
+
+    /**
+     * @brief Builds the Discord bot's support server invite URL.
+     *
+     * @return std::string The Discord bot's support server invite URL, or an empty string if it has none.
+     * @since 2.1.0
+     */
+    std::string support() const;
+
+    /**
+     * @brief Builds the invite URL of this Discord bot.
+     *
+     * @return std::string The invite URL of this Discord bot.
+     * @since 2.1.0
+     */
+    std::string invite() const;
+
+    /**
+     * @brief Builds the URL of this Discord bot's Top.gg page.
+     *
+     * @return std::string The URL of this Discord bot's Top.gg page.
+     * @since 2.1.0
+     */
+    std::string url() const;
+
+    friend class internal_parser;
+    friend class view_scanner;
+  };
+
+  /**
+   * @brief A read-only view of a user's social links, if they have any.
+   *
+   * @see topgg::user_view::socials
+   * @since 2.1.0
+   */
+  struct user_socials_view {
+    /**
+     * @brief The URL of this user's GitHub account.
+     *
+     * @since 2.1.0
+     */
+    std::string_view github;
+
+    /**
+     * @brief The URL of this user's Instagram account.
+     *
+     * @since 2.1.0
+     */
+    std::string_view instagram;
+
+    /**
+     * @brief The URL of this user's Reddit account.
+     *
+     * @since 2.1.0
+     */
+    std::string_view reddit;
+
+    /**
+     * @brief The URL of this user's Twitter account.
+     *
+     * @since 2.1.0
+     */
+    std::string_view twitter;
+
+    /**
+     * @brief The URL of this user's YouTube channel.
+     *
+     * @since 2.1.0
+     */
+    std::string_view youtube;
+  };
+
+  /**
+   * @brief A read-only view of a user logged into Top.gg.
+   *
+   * @see topgg::account_view
+   * @see topgg::client::get_user_view
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT user_view: public account_view {
+    view_span m_bio;
+    view_span m_banner;
+    view_span m_github;
+    view_span m_instagram;
+    view_span m_reddit;
+    view_span m_twitter;
+    view_span m_youtube;
+    bool m_is_supporter;
+    bool m_is_moderator;
+    bool m_is_web_moderator;
+    bool m_is_admin;
+
+    user_view() noexcept;
+
+  public:
+    /**
+     * @brief Returns the user's bio.
+     *
+     * @return std::string_view The user's bio.
+     * @since 2.1.0
+     */
+    inline std::string_view bio() const noexcept {
+      return at(m_bio);
+    }
+
+    /**
+     * @brief Returns the URL of this user's profile banner image.
+     *
+     * @return std::string_view The URL of this user's profile banner image.
+     * @since 2.1.0
+     */
+    inline std::string_view banner() const noexcept {
+      return at(m_banner);
+    }
+
+    /**
+     * @brief Returns this user's social links.
+     *
+     * @return user_socials_view This user's social links.
+     * @since 2.1.0
+     */
+    inline user_socials_view socials() const noexcept {
+      return user_socials_view{at(m_github), at(m_instagram), at(m_reddit), at(m_twitter), at(m_youtube)};
+    }
+
+    /**
+     * @brief Returns whether this user is a Top.gg supporter or not.
+     *
+     * @return bool Whether this user is a Top.gg supporter or not.
+     * @since 2.1.0
+     */
+    inline bool is_supporter() const noexcept {
+      return m_is_supporter;
+    }
+
+    /**
+     * @brief Returns whether this user is a Top.gg moderator or not.
+     *
+     * @return bool Whether this user is a Top.gg moderator or not.
+     * @since 2.1.0
+     */
+    inline bool is_moderator() const noexcept {
+      return m_is_moderator;
+    }
+
+    /**
+     * @brief Returns whether this user is a Top.gg website moderator or not.
+     *
+     * @return bool Whether this user is a Top.gg website moderator or not.
+     * @since 2.1.0
+     */
+    inline bool is_web_moderator() const noexcept {
+      return m_is_web_moderator;
+    }
+
+    /**
+     * @brief Returns whether this user is a Top.gg website administrator or not.
+     *
+     * @return bool Whether this user is a Top.gg website administrator or not.
+     * @since 2.1.0
+     */
+    inline bool is_admin() const noexcept {
+      return m_is_admin;
+    }
+
+    friend class internal_parser;
+    friend class view_scanner;
+  };
+
+  /**
+   * @brief The callback function to call when get_bot_view completes.
+   *
+   * @see topgg::client::get_bot_view
+   * @since 2.1.0
+   */
+  using get_bot_view_completion_t = std::function<void(result<bot_view>&)>;
+
+  /**
+   * @brief The callback function to call when get_user_view completes.
+   *
+   * @see topgg::client::get_user_view
+   * @since 2.1.0
+   */
+  using get_user_view_completion_t = std::function<void(result<user_view>&)>;
+
+  /**
+   * @brief The callback function to call when finish_views completes.
+   *
+   * @see topgg::bot_query::finish_views
+   * @since 2.1.0
+   */
+  using get_bot_views_completion_t = std::function<void(result<std::vector<bot_view>>&)>;
+}; // namespace topgg
@@ -0,0 +1,199 @@
+/**
+ * @module topgg
+ * @file vote_journal.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#ifndef _WIN32
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace topgg {
+  /**
+   * @brief A vote recorded in a vote journal.
+   *
+   * @see topgg::vote_journal
+   * @since 2.1.0
+   */
+  struct journal_record {
+    /**
+     * @brief The ID of the user who voted.
+     *
+     * @since 2.1.0
+     */
+    dpp::snowflake voter_id;
+
+    /**
+     * @brief The unix timestamp of when the vote was observed.
+     *
+     * @since 2.1.0
+     */
+    time_t timestamp;
+  };
+
+  /**
+   * @brief The callback function to call for every record replayed from a vote journal.
+   *
+   * @see topgg::vote_journal::replay
+   * @since 2.1.0
+   */
+  using journal_replay_callback_t = std::function<void(const journal_record&)>;
+
+  /**
+   * @brief Tuning options for the vote journal.
+   *
+   * @see topgg::vote_journal
+   * @since 2.1.0
+   */
+  struct vote_journal_options {
+    /**
+     * @brief The amount of records per segment file. Defaults to 65536, which makes each segment 1.5 MiB.
+     *
+     * @since 2.1.0
+     */
+    size_t segment_records = 65536;
+
+    /**
+     * @brief The amount of appended records after which the journal is synced to disk. Defaults to 64.
+     *
+     * @since 2.1.0
+     */
+    size_t sync_every = 64;
+
+    /**
+     * @brief The maximum delay in seconds between an append and the sync that covers it, checked on every append. Defaults to one second.
+     *
+     * @since 2.1.0
+     */
+    time_t sync_interval = 1;
+  };
+
+  /**
+   * @brief A durable, append-only journal of observed votes, so that votes seen before a restart aren't lost.
+   *
+   * Records are fixed-size and checksummed, and are written straight into memory-mapped segment files in a directory. Syncing to disk is batched by record count and by time.
+   * Replaying scans the mapped segments in order and stops at the first torn or unwritten record of each one.
+   * Whole segments are deleted by compact() once all of their records are older than the given cutoff, e.g. Top.gg's 12 hour vote window.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::vote_journal journal{"votes"};
+   *
+   * journal.replay([](const auto& record) {
+   *   // reward record.voter_id if it hasn't been rewarded yet
+   * });
+   *
+   * topgg_client.start_vote_detector([&journal](const auto& voter) {
+   *   journal.append(voter.id);
+   * });
+   *
+   * // once in a while
+   * journal.compact(time(nullptr) - 12 * 60 * 60);
+   * ```
+   *
+   * @note Only available on POSIX systems. A journal directory must only be opened by one vote_journal at a time.
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT vote_journal {
+    struct segment {
+      uint64_t sequence;
+      time_t newest;
+    };
+
+    struct mapped_segment {
+      unsigned char* mapping;
+      size_t size;
+      size_t count;
+      time_t newest;
+      int fd;
+    };
+
+    std::string m_directory;
+    vote_journal_options m_options;
+    std::mutex m_mutex;
+    std::vector<segment> m_sealed;
+    segment m_active;
+    unsigned char* m_mapping;
+    size_t m_mapping_size;
+    size_t m_count;
+    size_t m_synced;
+    time_t m_last_sync;
+    int m_fd;
+
+    std::string path(const uint64_t sequence) const;
+    mapped_segment open_segment(const uint64_t sequence, const bool create) const;
+    void use_segment(const uint64_t sequence, const mapped_segment& opened) noexcept;
+    void close_segment() noexcept;
+    void sync_locked() noexcept;
+
+  public:
+    /**
+     * @brief Opens or creates a vote journal.
+     *
+     * @param directory The directory that holds the journal's segment files. It's created if it doesn't exist.
+     * @param options The journal's tuning options.
+     * @throw std::invalid_argument Throws if segment_records is zero.
+     * @throw std::runtime_error Throws if the directory or its latest segment file can't be opened.
+     * @since 2.1.0
+     */
+    explicit vote_journal(const std::string& directory, const vote_journal_options& options = {});
+
+    vote_journal(const vote_journal&) = delete;
+    vote_journal& operator=(const vote_journal&) = delete;
+
+    /**
+     * @brief Appends a vote to the journal.
+     *
+     * @param voter_id The ID of the user who voted.
+     * @param timestamp The unix timestamp of when the vote was observed. Defaults to now.
+     * @throw std::runtime_error Throws if a new segment file can't be created.
+     * @since 2.1.0
+     */
+    void append(const dpp::snowflake voter_id, const time_t timestamp = time(nullptr));
+
+    /**
+     * @brief Calls the callback for every valid record in the journal, oldest segment first.
+     *
+     * @param callback The callback function to call for every record.
+     * @return size_t The amount of replayed records.
+     * @note The callback must not append to the journal.
+     * @since 2.1.0
+     */
+    size_t replay(const journal_replay_callback_t& callback);
+
+    /**
+     * @brief Syncs every appended record to disk right away.
+     *
+     * @since 2.1.0
+     */
+    void sync() noexcept;
+
+    /**
+     * @brief Deletes every sealed segment whose records are all older than a cutoff. The segment being appended to is never deleted.
+     *
+     * @param cutoff The unix timestamp before which records may be deleted.
+     * @return size_t The amount of deleted segments.
+     * @since 2.1.0
+     */
+    size_t compact(const time_t cutoff);
+
+    /**
+     * @brief The destructor. Syncs and closes the journal.
+     */
+    ~vote_journal();
+  };
+}; // namespace topgg
+
+#endif
@@ -0,0 +1,217 @@
+/**
+ * @module topgg
+ * @file webhook.h
+ * @brief The official C++ wrapper for the Top.gg API.
+ * @authors Top.gg, null8626
+ * @copyright Copyright (c) 2024-2025 Top.gg & null8626
+ * @date 2025-02-19
+ * @version 2.0.1
+ */
+
+#pragma once
+
+#include <topgg/topgg.h>
+
+#ifdef __linux__
+
+#include <unordered_map>
+#include <string_view>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+namespace topgg {
+  class webhook_worker;
+
+  /**
+   * @brief A vote received through a Top.gg webhook.
+   *
+   * @see topgg::webhook_server
+   * @since 2.1.0
+   */
+  struct webhook_vote {
+    /**
+     * @brief The ID of the Discord bot or server that received the vote.
+     *
+     * @since 2.1.0
+     */
+    dpp::snowflake receiver_id;
+
+    /**
+     * @brief The ID of the user who voted.
+     *
+     * @since 2.1.0
+     */
+    dpp::snowflake voter_id;
+
+    /**
+     * @brief Whether the vote was sent through Top.gg's webhook test button or not.
+     *
+     * @since 2.1.0
+     */
+    bool is_test;
+
+    /**
+     * @brief Whether the weekend multiplier is active or not, meaning the vote counts twice. Always false for Discord servers.
+     *
+     * @since 2.1.0
+     */
+    bool is_weekend;
+
+    /**
+     * @brief The query string parameters found on the vote page, if any.
+     *
+     * @since 2.1.0
+     */
+    std::string query;
+  };
+
+  /**
+   * @brief The callback function to call for every vote received on a webhook route.
+   *
+   * @see topgg::webhook_server::route
+   * @since 2.1.0
+   */
+  using webhook_vote_callback_t = std::function<void(const webhook_vote&)>;
+
+  /**
+   * @brief Tuning options for the webhook server.
+   *
+   * @see topgg::webhook_server
+   * @since 2.1.0
+   */
+  struct webhook_options {
+    /**
+     * @brief The IPv4 address to listen on. Defaults to every address.
+     *
+     * @since 2.1.0
+     */
+    std::string address = "0.0.0.0";
+
+    /**
+     * @brief The port to listen on. Defaults to 8080.
+     *
+     * @since 2.1.0
+     */
+    uint16_t port = 8080;
+
+    /**
+     * @brief The amount of acceptor threads, each with its own listening socket. Zero uses one per CPU core. Defaults to zero.
+     *
+     * @since 2.1.0
+     */
+    size_t acceptors = 0;
+
+    /**
+     * @brief The amount of worker threads that call the route callbacks. Defaults to one.
+     *
+     * @since 2.1.0
+     */
+    size_t workers = 1;
+
+    /**
+     * @brief The maximum size of a request's headers and body in bytes. Larger requests are rejected. Defaults to 16 KiB.
+     *
+     * @since 2.1.0
+     */
+    size_t max_request_size = 16384;
+
+    /**
+     * @brief The delay in seconds after which idle keep-alive connections are closed. Defaults to 1 minute.
+     *
+     * @since 2.1.0
+     */
+    time_t idle_timeout = 60;
+  };
+
+  /**
+   * @brief A built-in HTTP server that receives votes through Top.gg webhooks.
+   *
+   * Each acceptor thread runs its own epoll loop over its own SO_REUSEPORT listening socket, so the kernel balances new connections across them.
+   * Votes are parsed straight from the request body without building a dpp::json DOM and are handed over to the worker threads through lock-free queues, so slow callbacks never hold back the acceptors.
+   * Each route has its own path and authorization, which lets a single server receive the votes of several Discord bots and servers.
+   *
+   * Example:
+   *
+   * ```cpp
+   * topgg::webhook_server webhook{};
+   *
+   * webhook.route("/votes", "your webhook authorization", [](const auto& vote) {
+   *   std::cout << vote.voter_id << " voted for " << vote.receiver_id << std::endl;
+   * });
+   *
+   * webhook.start();
+   * ```
+   *
+   * @note Only available on Linux. The server speaks plain HTTP, put it behind a reverse proxy for HTTPS.
+   * @note Callbacks run on the worker threads. Votes from the same user are always handled by the same worker, in order.
+   * @since 2.1.0
+   */
+  class TOPGG_EXPORT webhook_server {
+    struct route_entry {
+      std::string authorization;
+      webhook_vote_callback_t callback;
+    };
+
+    webhook_options m_options;
+    std::unordered_map<std::string, route_entry> m_routes;
+    std::vector<std::unique_ptr<webhook_worker>> m_workers;
+    std::vector<std::thread> m_acceptor_threads;
+    std::vector<int> m_listeners;
+    std::atomic<bool> m_running;
+    int m_stop_fd;
+
+    uint16_t dispatch(const std::string_view path, const std::string_view authorization, const std::string_view body);
+    void accept_loop(const int listener);
+
+  public:
+    /**
+     * @brief Constructs a webhook server that isn't listening yet.
+     *
+     * @param options The server's tuning options.
+     * @since 2.1.0
+     */
+    explicit webhook_server(const webhook_options& options = {});
+
+    webhook_server(const webhook_server&) = delete;
+    webhook_server& operator=(const webhook_server&) = delete;
+
+    /**
+     * @brief Adds a webhook route.
+     *
+     * @param path The route's path, e.g. "/votes".
+     * @param authorization The authorization set on the Discord bot or server's Top.gg webhook settings.
+     * @param callback The callback function to call for every vote received on this route.
+     * @throw std::invalid_argument Throws if the server is already running or if the path is already routed.
+     * @since 2.1.0
+     */
+    void route(const std::string& path, const std::string& authorization, const webhook_vote_callback_t& callback);
+
+    /**
+     * @brief Starts listening and spawns the acceptor and worker threads.
+     *
+     * @throw std::runtime_error Throws if the server couldn't listen on its address and port.
+     * @note This function has no effect if the server is already running.
+     * @since 2.1.0
+     */
+    void start();
+
+    /**
+     * @brief Stops listening, closes every connection and waits for the workers to finish the votes they already received.
+     *
+     * @note This function has no effect if the server is already stopped.
+     * @since 2.1.0
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief The destructor. Stops the server if it's running.
+     */
+    ~webhook_server();
+  };
+}; // namespace topgg
+
+#endif
@@ -2,16 +2,108 @@
 
 using topgg::client;
 
-client::client(dpp::cluster& cluster, const std::string& token): m_token(token), m_cluster(cluster), m_autoposter_timer(0) {
+#include <charconv>
+
+client::client(dpp::cluster& cluster, const std::string& token): m_token(token), m_cluster(cluster), m_owner(nullptr), m_cache(nullptr), m_cache_bot_id(0), m_ratelimited_until(std::make_shared<std::atomic<time_t>>(0)), m_autoposter_timer(0), m_vote_detector_timer(0), m_vote_detector(std::make_shared<vote_detector_state>()), m_autoposter(std::make_shared<autoposter_state>()) {
   m_headers.insert(std::pair("Authorization", "Bearer " + token));
   m_headers.insert(std::pair("Connection", "close"));
   m_headers.insert(std::pair("Content-Type", "application/json"));
   m_headers.insert(std::pair("User-Agent", "topgg (https://github.com/top-gg-community/cpp-sdk) D++"));
 }
 
-void client::get_bot(const dpp::snowflake bot_id, const topgg::get_bot_completion_t& callback) {
-  basic_request<topgg::bot>("/bots/" + std::to_string(bot_id), callback, [](const auto& j) {
-    return topgg::bot{j};
+client::client(topgg::multi_client& owner, dpp::cluster& cluster, const std::string& token): client(cluster, token) {
+  m_owner = &owner;
+}
+
+/**
+ * Reads the retry_after value of a 429 response, falling back to a minute if it's missing.
+ */
+static time_t get_retry_after(const std::string& body) noexcept {
+  return static_cast<time_t>(topgg::internal_result::find_retry_after(body).value_or(60));
+}
+
+dpp::timer client::start_timer(std::function<void()> callback, const time_t interval) {
+  if (m_owner != nullptr) {
+    return m_owner->schedule(std::move(callback), interval);
+  }
+
+  /**
+   * Create a D++ timer, this is managed by the D++ cluster and ticks every n seconds.
+   * It can be stopped at any time without blocking, and does not need to create extra threads.
+   */
+  return m_cluster.start_timer([callback = std::move(callback)](TOPGG_UNUSED dpp::timer) {
+    callback();
+  }, interval);
+}
+
+void client::stop_timer(const dpp::timer timer) noexcept {
+  if (m_owner != nullptr) {
+    m_owner->unschedule(timer);
+  } else {
+    m_cluster.stop_timer(timer);
+  }
+}
+
+time_t client::get_ratelimit_remaining() const noexcept {
+  const auto now{time(nullptr)};
+  const auto until{m_ratelimited_until->load(std::memory_order_relaxed)};
+
+  return now < until ? until - now : 0;
+}
+
+dpp::http_request_completion_t client::make_ratelimited_response(const time_t retry_after) {
+  dpp::http_request_completion_t response{};
+
+  response.status = 429;
+  response.body = "{\"retry_after\":" + std::to_string(retry_after) + "}";
+
+  return response;
+}
+
+/**
+ * D++ copies the URL into its own request right away, so each thread reuses one buffer instead of allocating a new URL for every request.
+ * The returned URL is only valid until the next request made from the same thread.
+ */
+static std::string& format_url(const std::string_view path) {
+  thread_local std::string url{};
+
+  url.assign("https://top.gg/api").append(path);
+
+  return url;
+}
+
+const std::string& client::make_url(const std::string_view path) {
+  return format_url(path);
+}
+
+const std::string& client::make_url(const std::string_view prefix, const dpp::snowflake id) {
+  char digits[20]{};
+  const auto end{std::to_chars(digits, digits + sizeof(digits), static_cast<uint64_t>(id)).ptr};
+
+  return format_url(prefix).append(digits, end);
+}
+
+void client::record_ratelimit(std::atomic<time_t>& ratelimited_until, const dpp::http_request_completion_t& response) noexcept {
+  if (response.status == 429) {
+    ratelimited_until.store(time(nullptr) + get_retry_after(response.body), std::memory_order_relaxed);
+  }
+}
+
+#ifndef _WIN32
+bool client::find_cached(const uint32_t endpoint, const dpp::snowflake id, std::string& body) const {
+  return m_cache->find(m_cache_bot_id, endpoint, id, body);
+}
+
+void client::store_cached(topgg::shared_cache* cache, const dpp::snowflake bot_id, const uint32_t endpoint, const dpp::snowflake id, const dpp::http_request_completion_t& response) noexcept {
+  if (response.status >= 200 && response.status < 300 && response.error == dpp::h_success) {
+    cache->store(bot_id, endpoint, id, response.body);
+  }
+}
+#endif
+
+void client::get_bot(const dpp::snowflake bot_id, topgg::get_bot_completion_t callback) {
+  basic_request<topgg::bot>("/bots/", bot_id, std::move(callback), [](auto& body) {
+    return topgg::internal_parser::parse<topgg::bot>(body);
   });
 }
 
@@ -19,11 +111,15 @@ void client::get_bot(const dpp::snowflake bot_id, const topgg::get_bot_completio
 topgg::async_result<topgg::bot> client::co_get_bot(const dpp::snowflake bot_id) {
   return topgg::async_result<topgg::bot>{ [this, bot_id] <typename C> (C&& cc) { return get_bot(bot_id, std::forward<C>(cc)); }};
 }
+
+topgg::lazy_result<topgg::bot> client::co_get_bot_lazy(const dpp::snowflake bot_id) {
+  return topgg::lazy_result<topgg::bot>{ [this, bot_id] <typename C> (C&& cc) { return get_bot(bot_id, std::forward<C>(cc)); }};
+}
 #endif
 
-void client::get_user(const dpp::snowflake user_id, const topgg::get_user_completion_t& callback) {
-  basic_request<topgg::user>("/users/" + std::to_string(user_id), callback, [](const auto& j) {
-    return topgg::user{j};
+void client::get_user(const dpp::snowflake user_id, topgg::get_user_completion_t callback) {
+  cached_request<topgg::user>(topgg::shared_cache::user_endpoint, user_id, "/users/", std::move(callback), [](auto& body) {
+    return topgg::internal_parser::parse<topgg::user>(body);
   });
 }
 
@@ -31,10 +127,46 @@ void client::get_user(const dpp::snowflake user_id, const topgg::get_user_comple
 topgg::async_result<topgg::user> client::co_get_user(const dpp::snowflake user_id) {
   return topgg::async_result<topgg::user>{ [this, user_id] <typename C> (C&& cc) { return get_user(user_id, std::forward<C>(cc)); }};
 }
+
+topgg::lazy_result<topgg::user> client::co_get_user_lazy(const dpp::snowflake user_id) {
+  return topgg::lazy_result<topgg::user>{ [this, user_id] <typename C> (C&& cc) { return get_user(user_id, std::forward<C>(cc)); }};
+}
 #endif
 
-void client::post_stats(const topgg::post_stats_completion_t& callback)  {
-  post_stats(stats{m_cluster}, callback);
+void client::get_bot_view(const dpp::snowflake bot_id, topgg::get_bot_view_completion_t callback) {
+  basic_request<topgg::bot_view>("/bots/", bot_id, std::move(callback), [](auto& body) {
+    return topgg::internal_parser::parse_view<topgg::bot_view>(body);
+  });
+}
+
+#ifdef DPP_CORO
+topgg::async_result<topgg::bot_view> client::co_get_bot_view(const dpp::snowflake bot_id) {
+  return topgg::async_result<topgg::bot_view>{ [this, bot_id] <typename C> (C&& cc) { return get_bot_view(bot_id, std::forward<C>(cc)); }};
+}
+
+topgg::lazy_result<topgg::bot_view> client::co_get_bot_view_lazy(const dpp::snowflake bot_id) {
+  return topgg::lazy_result<topgg::bot_view>{ [this, bot_id] <typename C> (C&& cc) { return get_bot_view(bot_id, std::forward<C>(cc)); }};
+}
+#endif
+
+void client::get_user_view(const dpp::snowflake user_id, topgg::get_user_view_completion_t callback) {
+  basic_request<topgg::user_view>("/users/", user_id, std::move(callback), [](auto& body) {
+    return topgg::internal_parser::parse_view<topgg::user_view>(body);
+  });
+}
+
+#ifdef DPP_CORO
+topgg::async_result<topgg::user_view> client::co_get_user_view(const dpp::snowflake user_id) {
+  return topgg::async_result<topgg::user_view>{ [this, user_id] <typename C> (C&& cc) { return get_user_view(user_id, std::forward<C>(cc)); }};
+}
+
+topgg::lazy_result<topgg::user_view> client::co_get_user_view_lazy(const dpp::snowflake user_id) {
+  return topgg::lazy_result<topgg::user_view>{ [this, user_id] <typename C> (C&& cc) { return get_user_view(user_id, std::forward<C>(cc)); }};
+}
+#endif
+
+void client::post_stats(topgg::post_stats_completion_t callback)  {
+  post_stats(stats{m_cluster}, std::move(callback));
 }
 
 #ifdef DPP_CORO
@@ -43,13 +175,13 @@ dpp::async<bool> client::co_post_stats() {
 }
 #endif
 
-void client::post_stats(const stats& s, const topgg::post_stats_completion_t& callback)  {
+void client::post_stats(const stats& s, topgg::post_stats_completion_t callback)  {
   std::multimap<std::string, std::string> headers{m_headers};
   const auto s_json{s.to_json()};
 
   headers.insert(std::pair("Content-Length", std::to_string(s_json.size())));
 
-  m_cluster.request("https://top.gg/api/bots/stats", dpp::m_post, [callback](const auto& response) { callback(response.error == dpp::h_success && response.status < 400); }, s_json, "application/json", headers);
+  send("https://top.gg/api/bots/stats", dpp::m_post, [callback = std::move(callback)](const auto& response) { callback(response.error == dpp::h_success && response.status < 400); }, s_json, headers);
 }
 
 #ifdef DPP_CORO
@@ -58,9 +190,9 @@ dpp::async<bool> client::co_post_stats(const stats& s) {
 }
 #endif
 
-void client::get_stats(const topgg::get_stats_completion_t& callback) {
-  basic_request<topgg::stats>("/bots/stats", callback, [](const auto& j) {
-    return topgg::stats{j};
+void client::get_stats(topgg::get_stats_completion_t callback) {
+  basic_request<topgg::stats>("/bots/stats", std::move(callback), [](auto& body) {
+    return topgg::stats{dpp::json::parse(body)};
   });
 }
 
@@ -68,17 +200,15 @@ void client::get_stats(const topgg::get_stats_completion_t& callback) {
 topgg::async_result<topgg::stats> client::co_get_stats() {
   return topgg::async_result<topgg::stats>{ [this] <typename C> (C&& cc) { return get_stats(std::forward<C>(cc)); }};
 }
-#endif
-
-void client::get_voters(const topgg::get_voters_completion_t& callback) {
-  basic_request<std::vector<topgg::voter>>("/bots/votes", callback, [](const auto& j) {
-    std::vector<topgg::voter> voters{};
 
-    for (const auto& part: j) {
-      voters.push_back(topgg::voter{part});
-    }
+topgg::lazy_result<topgg::stats> client::co_get_stats_lazy() {
+  return topgg::lazy_result<topgg::stats>{ [this] <typename C> (C&& cc) { return get_stats(std::forward<C>(cc)); }};
+}
+#endif
 
-    return voters;
+void client::get_voters(topgg::get_voters_completion_t callback) {
+  basic_request<std::vector<topgg::voter>>("/bots/votes", std::move(callback), [](auto& body) {
+    return topgg::internal_parser::parse_array<topgg::voter>(body);
   });
 }
 
@@ -86,12 +216,62 @@ void client::get_voters(const topgg::get_voters_completion_t& callback) {
 topgg::async_result<std::vector<topgg::voter>> client::co_get_voters() {
   return topgg::async_result<std::vector<topgg::voter>>{ [this] <typename C> (C&& cc) { return get_voters(std::forward<C>(cc)); }};
 }
+
+topgg::lazy_result<std::vector<topgg::voter>> client::co_get_voters_lazy() {
+  return topgg::lazy_result<std::vector<topgg::voter>>{ [this] <typename C> (C&& cc) { return get_voters(std::forward<C>(cc)); }};
+}
 #endif
 
 
-void client::has_voted(const dpp::snowflake user_id, const topgg::has_voted_completion_t& callback) {
-  basic_request<bool>("/bots/votes?userId=" + std::to_string(user_id), callback, [](const auto& j) {
-    return j["voted"].template get<uint8_t>() != 0;
+/**
+ * Reads a single top-level boolean or integer field from a tiny fixed-shape response such as {"voted":1}, without building a DOM.
+ */
+bool client::read_flag(const std::string& body, const std::string_view key) {
+  size_t position{};
+
+  // the key must be quoted and followed by a colon, so that it isn't matched inside of another key or a value
+  while ((position = body.find(key, position)) != std::string::npos) {
+    const auto end{position + key.size()};
+
+    if (position != 0 && body[position - 1] == '"' && end < body.size() && body[end] == '"') {
+      const auto colon{body.find_first_not_of(" \t\r\n", end + 1)};
+
+      if (colon != std::string::npos && body[colon] == ':') {
+        position = body.find_first_not_of(" \t\r\n", colon + 1);
+        break;
+      }
+    }
+
+    position = end;
+  }
+
+  if (position == std::string::npos) {
+    throw std::runtime_error{"Malformed JSON response."};
+  }
+
+  switch (body[position]) {
+    case 't':
+      return true;
+
+    case 'f':
+      return false;
+
+    default: {
+      uint64_t value{};
+      const auto parsed{std::from_chars(body.data() + position, body.data() + body.size(), value)};
+
+      if (parsed.ec != std::errc{}) {
+        throw std::runtime_error{"Malformed JSON response."};
+      }
+
+      return value != 0;
+    }
+  }
+}
+
+void client::has_voted(const dpp::snowflake user_id, topgg::has_voted_completion_t callback) {
+  cached_request<bool>(topgg::shared_cache::vote_endpoint, user_id, "/bots/votes?userId=", std::move(callback), [](auto& body) {
+    return read_flag(body, "voted");
   });
 }
 
@@ -99,11 +279,15 @@ void client::has_voted(const dpp::snowflake user_id, const topgg::has_voted_comp
 topgg::async_result<bool> client::co_has_voted(const dpp::snowflake user_id) {
   return topgg::async_result<bool>{ [user_id, this] <typename C> (C&& cc) { return has_voted(user_id, std::forward<C>(cc)); }};
 }
+
+topgg::lazy_result<bool> client::co_has_voted_lazy(const dpp::snowflake user_id) {
+  return topgg::lazy_result<bool>{ [user_id, this] <typename C> (C&& cc) { return has_voted(user_id, std::forward<C>(cc)); }};
+}
 #endif
 
-void client::is_weekend(const topgg::is_weekend_completion_t& callback) {
-  basic_request<bool>("/weekend", callback, [](const auto& j) {
-    return j["is_weekend"].template get<bool>();
+void client::is_weekend(topgg::is_weekend_completion_t callback) {
+  basic_request<bool>("/weekend", std::move(callback), [](auto& body) {
+    return read_flag(body, "is_weekend");
   });
 }
 
@@ -111,45 +295,358 @@ void client::is_weekend(const topgg::is_weekend_completion_t& callback) {
 topgg::async_result<bool> client::co_is_weekend() {
   return topgg::async_result<bool>{ [this] <typename C> (C&& cc) { return is_weekend(std::forward<C>(cc)); }};
 }
+
+topgg::lazy_result<bool> client::co_is_weekend_lazy() {
+  return topgg::lazy_result<bool>{ [this] <typename C> (C&& cc) { return is_weekend(std::forward<C>(cc)); }};
+}
 #endif
 
 void client::start_autoposter(const time_t delay) {
+  autoposter_options options{};
+  options.delay = delay;
+
+  start_autoposter(options);
+}
+
+void client::start_autoposter(const topgg::autoposter_options& options) {
   start_autoposter([](dpp::cluster& bot) {
     return stats{bot};
-  }, delay);
+  }, options);
 }
 
 void client::start_autoposter(const topgg::custom_autopost_callback_t& callback, const time_t delay) {
+  autoposter_options options{};
+  options.delay = delay;
+
+  start_autoposter(callback, options);
+}
+
+void client::start_autoposter(const topgg::custom_autopost_callback_t& callback, const topgg::autoposter_options& options) {
   /**
    * Check the timer duration is not less than 15 minutes
    */
-  if (delay < 15 * 60) {
+  if (options.delay < 15 * 60) {
     throw std::invalid_argument{"Delay mustn't be shorter than 15 minutes."};
+  } else if (options.retry_delay <= 0) {
+    throw std::invalid_argument{"Retry delay must be positive."};
+  } else if (options.ready_delay < 0) {
+    throw std::invalid_argument{"Ready delay mustn't be negative."};
   }
   
+  if (!m_autoposter_timer) {
+    {
+      std::lock_guard lock{m_autoposter->mutex};
+
+      m_autoposter->callback = callback;
+      m_autoposter->options = options;
+      m_autoposter->last_posted.reset();
+      m_autoposter->ready_shards.clear();
+      m_autoposter->next_check = 0;
+      m_autoposter->backoff = 0;
+      m_autoposter->running = true;
+    }
+
+    if (options.post_on_ready) {
+      m_autoposter->ready_handle = m_cluster.on_ready(m_liveness.guard([this](const dpp::ready_t& event) {
+        std::lock_guard lock{m_autoposter->mutex};
+        auto& state{*m_autoposter};
+
+        /**
+         * Every shard sends its own READY before its servers arrive, so a count taken right away would be partial.
+         * Only the last shard to become ready schedules a check, after giving the servers time to arrive.
+         */
+        if (!state.ready_shards.insert(event.shard).second) {
+          return;
+        }
+
+        const auto numshards{m_cluster.numshards};
+
+        /**
+         * With autosharding, the shard count is 0 until D++ gets it from Discord, and no amount of ready shards would ever match it.
+         * Until then the shard is only recorded, and if no later shard sees the resolved count, the regular interval still posts.
+         */
+        if (numshards == 0) {
+          return;
+        }
+
+        const auto clusters{std::max<uint32_t>(m_cluster.maxclusters, 1)};
+        // with clustering, this cluster only runs every maxclusters-th shard
+        const auto shards{numshards / clusters + (m_cluster.cluster_id < numshards % clusters)};
+
+        if (state.ready_shards.size() != shards) {
+          return;
+        }
+
+        // don't cut a pending retry short, Top.gg may still be ratelimiting us
+        if (state.backoff == 0) {
+          state.next_check = time(nullptr) + state.options.ready_delay;
+        }
+      }));
+    }
+
+    /**
+     * Like the vote detector, the timer ticks at a short interval and each tick only checks once the next deadline has passed, so that retries don't have to wait for a full delay.
+     */
+    m_autoposter_timer = start_timer(m_liveness.guard([this]() {
+      autopost();
+    }), std::min<time_t>(options.retry_delay, 15));
+
+    autopost();
+  }
+}
+
+void client::autopost() {
+  custom_autopost_callback_t callback{};
+
+  {
+    std::lock_guard lock{m_autoposter->mutex};
+
+    if (!m_autoposter->running || m_autoposter->in_flight || time(nullptr) < m_autoposter->next_check) {
+      return;
+    }
+
+    m_autoposter->in_flight = true;
+    callback = m_autoposter->callback;
+  }
+
+  std::optional<stats> s{};
+
   /**
-   * Create a D++ timer, this is managed by the D++ cluster and ticks every n seconds.
-   * It can be stopped at any time without blocking, and does not need to create extra threads.
+   * This runs from a D++ timer, so an exception thrown by the callback is counted as a failure instead of being rethrown into D++.
    */
-  if (!m_autoposter_timer) {
-    m_autoposter_timer = m_cluster.start_timer([this, callback](TOPGG_UNUSED dpp::timer) {
-      const auto s{callback(m_cluster)};
-      const auto s_json{s.to_json()};
-      std::multimap<std::string, std::string> headers{m_headers};
-      headers.insert(std::pair("Content-Length", std::to_string(s_json.length())));
-      
-      m_cluster.request("https://top.gg/api/bots/stats", dpp::m_post, [](TOPGG_UNUSED const auto&) {}, s_json, "application/json", headers);
-    }, delay);
+  try {
+    s.emplace(callback(m_cluster));
+  } catch (...) {}
+
+  const auto server_count{s.has_value() ? s->server_count() : std::nullopt};
+
+  {
+    std::lock_guard lock{m_autoposter->mutex};
+    auto& state{*m_autoposter};
+
+    if (!s.has_value()) {
+      state.in_flight = false;
+      state.next_check = time(nullptr) + state.options.retry_delay;
+      state.failed++;
+
+      return;
+    }
+
+    /**
+     * A server count of zero before anything was posted usually means that no shard has received its guilds yet, so check again soon.
+     */
+    const auto empty{!state.last_posted.has_value() && server_count.has_value() && *server_count == 0};
+    bool skip{!server_count.has_value() || empty};
+
+    if (!skip && state.last_posted.has_value() && state.options.threshold > 0) {
+      const auto last{*state.last_posted};
+      const auto change{*server_count > last ? *server_count - last : last - *server_count};
+
+      skip = change < state.options.threshold;
+    }
+
+    if (skip) {
+      state.in_flight = false;
+      state.next_check = time(nullptr) + (empty ? state.options.retry_delay : state.options.delay);
+      state.skipped++;
+
+      return;
+    }
   }
+
+  const auto s_json{s->to_json()};
+  std::multimap<std::string, std::string> headers{m_headers};
+  headers.insert(std::pair("Content-Length", std::to_string(s_json.length())));
+  
+  send("https://top.gg/api/bots/stats", dpp::m_post, [state_ptr = m_autoposter, posted_count = *server_count](const auto& response) {
+    std::lock_guard lock{state_ptr->mutex};
+    auto& state{*state_ptr};
+    const auto now{time(nullptr)};
+
+    state.in_flight = false;
+
+    if (response.error == dpp::h_success && response.status < 400) {
+      state.last_posted = posted_count;
+      state.backoff = 0;
+      state.next_check = now + state.options.delay;
+      state.posted++;
+
+      return;
+    }
+
+    state.failed++;
+    state.backoff = state.backoff == 0 ? state.options.retry_delay : std::min<time_t>(state.backoff * 2, state.options.delay);
+
+    auto wait{state.backoff};
+
+    if (response.status == 429) {
+      wait = std::max<time_t>(wait, get_retry_after(response.body));
+    }
+
+    state.next_check = now + wait;
+  }, s_json, headers);
 }
 
 void client::stop_autoposter() noexcept {
   if (m_autoposter_timer) {
-    m_cluster.stop_timer(m_autoposter_timer);
+    stop_timer(m_autoposter_timer);
     m_autoposter_timer = 0;
+
+    if (m_autoposter->ready_handle) {
+      m_cluster.on_ready.detach(m_autoposter->ready_handle);
+      m_autoposter->ready_handle = 0;
+    }
+
+    std::lock_guard lock{m_autoposter->mutex};
+
+    m_autoposter->running = false;
+  }
+}
+
+topgg::autoposter_metrics client::get_autoposter_metrics() const noexcept {
+  return autoposter_metrics{m_autoposter->posted.load(std::memory_order_relaxed), m_autoposter->skipped.load(std::memory_order_relaxed), m_autoposter->failed.load(std::memory_order_relaxed)};
+}
+
+/**
+ * The amount of new votes the vote detector aims to see per poll.
+ * This is kept well below the 1000 voters returned by /bots/votes so that bursts between two polls don't get lost.
+ */
+static constexpr double VOTE_DETECTOR_TARGET_VOTES_PER_POLL = 100.0;
+
+void client::start_vote_detector(const topgg::vote_detected_callback_t& callback, const time_t min_delay, const time_t max_delay) {
+  if (min_delay < 60) {
+    throw std::invalid_argument{"Minimum delay mustn't be shorter than 1 minute."};
+  } else if (min_delay > max_delay) {
+    throw std::invalid_argument{"Minimum delay mustn't be longer than the maximum delay."};
+  }
+
+  if (!m_vote_detector_timer) {
+    {
+      std::lock_guard lock{m_vote_detector->mutex};
+
+      m_vote_detector->callback = callback;
+      m_vote_detector->min_delay = min_delay;
+      m_vote_detector->max_delay = max_delay;
+      m_vote_detector->next_poll = 0;
+      m_vote_detector->running = true;
+    }
+
+    /**
+     * The timer ticks at a fixed, short interval, and each tick only polls once the adaptive deadline has passed.
+     * This lets the polling interval change without having to restart the timer from inside its own callback.
+     */
+    m_vote_detector_timer = start_timer(m_liveness.guard([this]() {
+      poll_votes();
+    }), std::min<time_t>(min_delay, 15));
+
+    poll_votes();
+  }
+}
+
+void client::poll_votes() {
+  {
+    std::lock_guard lock{m_vote_detector->mutex};
+
+    if (m_vote_detector->in_flight || time(nullptr) < m_vote_detector->next_poll) {
+      return;
+    }
+
+    m_vote_detector->in_flight = true;
+  }
+
+  /**
+   * The detector's state is shared with the request, so that the client can be destroyed while a poll is still in flight.
+   */
+  send("https://top.gg/api/bots/votes", dpp::m_get, [detector = m_vote_detector](const auto& response) {
+    std::vector<topgg::voter> voters{};
+    std::vector<topgg::voter> new_voters{};
+    topgg::vote_detected_callback_t callback{};
+    bool malformed{};
+
+    /**
+     * Parse before taking the lock, voters are read straight from the response body without building a DOM.
+     */
+    if (response.error == dpp::h_success && response.status < 400) {
+      try {
+        voters = topgg::internal_parser::parse_array<topgg::voter>(response.body);
+      } catch (TOPGG_UNUSED const std::exception&) {
+        malformed = true;
+      }
+    }
+
+    {
+      std::lock_guard lock{detector->mutex};
+      auto& state{*detector};
+      const auto now{time(nullptr)};
+
+      state.in_flight = false;
+
+      if (!state.running) {
+        return;
+      }
+
+      if (response.error != dpp::h_success || response.status >= 400) {
+        state.next_poll = now + (response.status == 429 ? state.max_delay : state.min_delay);
+        return;
+      } else if (malformed) {
+        state.next_poll = now + state.min_delay;
+        return;
+      }
+
+      std::unordered_set<dpp::snowflake> snapshot{};
+      snapshot.reserve(voters.size());
+
+      for (auto& v: voters) {
+        const auto id{v.id};
+
+        if (snapshot.insert(id).second && state.has_snapshot && state.seen.count(id) == 0) {
+          new_voters.push_back(std::move(v));
+        }
+      }
+
+      state.seen.swap(snapshot);
+
+      if (state.has_snapshot && now > state.last_poll) {
+        const auto observed{static_cast<double>(new_voters.size()) / static_cast<double>(now - state.last_poll)};
+
+        state.votes_per_second = (state.votes_per_second + observed) / 2.0;
+      }
+
+      auto delay{state.max_delay};
+
+      if (state.votes_per_second > 0.0) {
+        delay = std::clamp(static_cast<time_t>(VOTE_DETECTOR_TARGET_VOTES_PER_POLL / state.votes_per_second), state.min_delay, state.max_delay);
+      }
+
+      state.has_snapshot = true;
+      state.last_poll = now;
+      state.next_poll = now + delay;
+
+      callback = state.callback;
+    }
+
+    for (const auto& v: new_voters) {
+      callback(v);
+    }
+  }, "", m_headers);
+}
+
+void client::stop_vote_detector() noexcept {
+  if (m_vote_detector_timer) {
+    stop_timer(m_vote_detector_timer);
+    m_vote_detector_timer = 0;
+
+    std::lock_guard lock{m_vote_detector->mutex};
+
+    m_vote_detector->seen.clear();
+    m_vote_detector->votes_per_second = 0.0;
+    m_vote_detector->has_snapshot = false;
+    m_vote_detector->running = false;
   }
 }
 
 client::~client() {
+  m_liveness.end();
   stop_autoposter();
+  stop_vote_detector();
 }
\ No newline at end of file
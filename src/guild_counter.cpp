@@ -0,0 +1,108 @@
+#include <topgg/topgg.h>
+
+using topgg::guild_counter;
+
+guild_counter::guild_counter(dpp::cluster& cluster): m_cluster(cluster), m_blocks(), m_total(0) {
+  m_create_handle = m_cluster.on_guild_create([this](const dpp::guild_create_t& event) {
+    add(event.shard);
+  });
+
+  m_delete_handle = m_cluster.on_guild_delete([this](const dpp::guild_delete_t& event) {
+    remove(event.shard);
+  });
+
+  m_ready_handle = m_cluster.on_ready([this](const dpp::ready_t& event) {
+    reset(event.shard);
+  });
+}
+
+/**
+ * Shard slots are allocated in blocks on first use, so that the counter works without knowing the shard count up front, which isn't known yet with automatic sharding.
+ * Blocks are never freed until the counter is destroyed, which lets readers use them without locking.
+ */
+guild_counter::shard_slot* guild_counter::slot(const uint32_t shard_id) noexcept {
+  const auto block_index{shard_id / SHARDS_PER_BLOCK};
+
+  if (block_index >= MAX_BLOCKS) {
+    return nullptr;
+  }
+
+  auto& block_ref{m_blocks[block_index]};
+  auto block{block_ref.load(std::memory_order_acquire)};
+
+  if (block == nullptr) {
+    auto new_block{new (std::nothrow) shard_slot[SHARDS_PER_BLOCK]};
+
+    if (new_block == nullptr) {
+      return nullptr;
+    }
+
+    if (block_ref.compare_exchange_strong(block, new_block, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      block = new_block;
+    } else {
+      delete[] new_block;
+    }
+  }
+
+  return &block[shard_id % SHARDS_PER_BLOCK];
+}
+
+void guild_counter::add(const uint32_t shard_id) noexcept {
+  const auto s{slot(shard_id)};
+
+  if (s != nullptr) {
+    s->count.fetch_add(1, std::memory_order_relaxed);
+    m_total.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void guild_counter::remove(const uint32_t shard_id) noexcept {
+  const auto s{slot(shard_id)};
+
+  if (s == nullptr) {
+    return;
+  }
+
+  auto count{s->count.load(std::memory_order_relaxed)};
+
+  /**
+   * A delete can arrive for a guild that was never counted, e.g. right after its shard was reset. Never let the counts wrap around.
+   */
+  do {
+    if (count == 0) {
+      return;
+    }
+  } while (!s->count.compare_exchange_weak(count, count - 1, std::memory_order_relaxed));
+
+  m_total.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void guild_counter::reset(const uint32_t shard_id) noexcept {
+  const auto s{slot(shard_id)};
+
+  if (s != nullptr) {
+    m_total.fetch_sub(s->count.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+}
+
+size_t guild_counter::shard(const uint32_t shard_id) const noexcept {
+  const auto block_index{shard_id / SHARDS_PER_BLOCK};
+
+  if (block_index >= MAX_BLOCKS) {
+    return 0;
+  }
+
+  const auto block{m_blocks[block_index].load(std::memory_order_acquire)};
+
+  return block == nullptr ? 0 : block[shard_id % SHARDS_PER_BLOCK].count.load(std::memory_order_relaxed);
+}
+
+guild_counter::~guild_counter() {
+  m_cluster.on_guild_create.detach(m_create_handle);
+  m_cluster.on_guild_delete.detach(m_delete_handle);
+  m_cluster.on_ready.detach(m_ready_handle);
+
+  for (auto& block: m_blocks) {
+    delete[] block.load(std::memory_order_relaxed);
+  }
+}
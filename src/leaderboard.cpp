@@ -0,0 +1,306 @@
+#include <topgg/topgg.h>
+
+using topgg::leaderboard;
+using topgg::leaderboard_entry;
+
+#include <algorithm>
+#include <limits>
+
+static constexpr uint32_t LEADERBOARD_NONE = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Snowflakes keep their worker and increment bits at the bottom, so they're mixed before being used as a hash.
+ */
+static inline uint64_t mix_snowflake(uint64_t id) noexcept {
+  id ^= id >> 33;
+  id *= 0xff51afd7ed558ccd;
+  id ^= id >> 33;
+  id *= 0xc4ceb9fe1a85ec53;
+  id ^= id >> 33;
+
+  return id;
+}
+
+leaderboard::leaderboard(const time_t window): m_highest(0), m_epoch(1), m_window(window), m_window_end(0) {
+  if (window < 0) {
+    throw std::invalid_argument{"Window mustn't be negative."};
+  }
+}
+
+const leaderboard::slot* leaderboard::find_slot(const uint64_t id) const noexcept {
+  if (m_slots.empty()) {
+    return nullptr;
+  }
+
+  const auto mask{m_slots.size() - 1};
+
+  for (auto i{mix_snowflake(id) & mask};; i = (i + 1) & mask) {
+    const auto& s{m_slots[i]};
+
+    if (s.epoch != m_epoch) {
+      return nullptr;
+    } else if (s.key == id) {
+      return &s;
+    }
+  }
+}
+
+void leaderboard::grow_slots() {
+  const auto capacity{std::max<size_t>(m_slots.size() * 2, 16)};
+
+  m_slots.assign(capacity, slot{0, 0, 0});
+
+  const auto mask{capacity - 1};
+
+  for (uint32_t index{}; index < m_users.size(); index++) {
+    auto i{mix_snowflake(m_users[index].id) & mask};
+
+    while (m_slots[i].epoch == m_epoch) {
+      i = (i + 1) & mask;
+    }
+
+    m_slots[i] = slot{m_users[index].id, index, m_epoch};
+  }
+}
+
+uint32_t leaderboard::find_or_insert(const uint64_t id) {
+  if ((m_users.size() + 1) * 2 > m_slots.size()) {
+    grow_slots();
+  }
+
+  const auto mask{m_slots.size() - 1};
+
+  /**
+   * Slots from a previous epoch count as empty, which is what lets reset() skip clearing the table.
+   */
+  for (auto i{mix_snowflake(id) & mask};; i = (i + 1) & mask) {
+    auto& s{m_slots[i]};
+
+    if (s.epoch != m_epoch) {
+      const auto index{static_cast<uint32_t>(m_users.size())};
+
+      m_users.push_back(user_entry{id, 0, LEADERBOARD_NONE, LEADERBOARD_NONE});
+      s = slot{id, index, m_epoch};
+
+      return index;
+    } else if (s.key == id) {
+      return s.index;
+    }
+  }
+}
+
+void leaderboard::grow_buckets(const size_t votes) {
+  if (votes < m_heads.size()) {
+    return;
+  }
+
+  const auto size{std::max<size_t>({votes + 1, m_heads.size() * 2, 16})};
+
+  m_heads.resize(size, LEADERBOARD_NONE);
+  m_tails.resize(size, LEADERBOARD_NONE);
+  m_bucket_sizes.resize(size, 0);
+
+  /**
+   * Rebuilds the Fenwick tree in linear time by pushing every node's sum to its parent.
+   */
+  m_tree.assign(m_bucket_sizes.begin(), m_bucket_sizes.end());
+
+  for (size_t i{1}; i < size; i++) {
+    const auto parent{i + (i & (~i + 1))};
+
+    if (parent < size) {
+      m_tree[parent] += m_tree[i];
+    }
+  }
+}
+
+void leaderboard::tree_add(size_t votes, const size_t amount, const bool remove) noexcept {
+  for (; votes < m_tree.size(); votes += votes & (~votes + 1)) {
+    if (remove) {
+      m_tree[votes] -= amount;
+    } else {
+      m_tree[votes] += amount;
+    }
+  }
+}
+
+size_t leaderboard::tree_prefix(size_t votes) const noexcept {
+  size_t sum{};
+
+  for (votes = std::min(votes, m_tree.size() - 1); votes > 0; votes -= votes & (~votes + 1)) {
+    sum += m_tree[votes];
+  }
+
+  return sum;
+}
+
+size_t leaderboard::tree_find(size_t users) const noexcept {
+  size_t position{};
+  size_t step{1};
+
+  while (step * 2 < m_tree.size()) {
+    step *= 2;
+  }
+
+  for (; step > 0; step /= 2) {
+    if (position + step < m_tree.size() && m_tree[position + step] < users) {
+      position += step;
+      users -= m_tree[position];
+    }
+  }
+
+  return position + 1;
+}
+
+void leaderboard::unlink(const uint32_t index) noexcept {
+  const auto& u{m_users[index]};
+
+  if (u.previous != LEADERBOARD_NONE) {
+    m_users[u.previous].next = u.next;
+  } else {
+    m_heads[u.votes] = u.next;
+  }
+
+  if (u.next != LEADERBOARD_NONE) {
+    m_users[u.next].previous = u.previous;
+  } else {
+    m_tails[u.votes] = u.previous;
+  }
+
+  m_bucket_sizes[u.votes]--;
+  tree_add(u.votes, 1, true);
+}
+
+void leaderboard::link(const uint32_t index) noexcept {
+  auto& u{m_users[index]};
+
+  u.previous = m_tails[u.votes];
+  u.next = LEADERBOARD_NONE;
+
+  if (u.previous != LEADERBOARD_NONE) {
+    m_users[u.previous].next = index;
+  } else {
+    m_heads[u.votes] = index;
+  }
+
+  m_tails[u.votes] = index;
+  m_bucket_sizes[u.votes]++;
+  tree_add(u.votes, 1, false);
+
+  m_highest = std::max(m_highest, u.votes);
+}
+
+void leaderboard::reset_locked() noexcept {
+  /**
+   * Bumping the epoch empties the hash table in constant time. The table is only cleared for real once every 2^32 resets, when the epoch wraps around.
+   */
+  if (++m_epoch == 0) {
+    std::fill(m_slots.begin(), m_slots.end(), slot{0, 0, 0});
+    m_epoch = 1;
+  }
+
+  m_users.clear();
+  std::fill(m_heads.begin(), m_heads.begin() + std::min(m_heads.size(), m_highest + 1), LEADERBOARD_NONE);
+  std::fill(m_tails.begin(), m_tails.begin() + std::min(m_tails.size(), m_highest + 1), LEADERBOARD_NONE);
+  std::fill(m_bucket_sizes.begin(), m_bucket_sizes.begin() + std::min(m_bucket_sizes.size(), m_highest + 1), 0);
+  std::fill(m_tree.begin(), m_tree.end(), 0);
+  m_highest = 0;
+}
+
+void leaderboard::ingest(const dpp::snowflake user_id, const time_t timestamp, const size_t votes) {
+  std::lock_guard lock{m_mutex};
+
+  if (votes == 0 || user_id == 0) {
+    return;
+  }
+
+  if (m_window > 0) {
+    if (timestamp >= m_window_end) {
+      reset_locked();
+      m_window_end = (timestamp / m_window + 1) * m_window;
+    } else if (timestamp < m_window_end - m_window) {
+      return;
+    }
+  }
+
+  const auto index{find_or_insert(user_id)};
+  const auto old_votes{m_users[index].votes};
+
+  grow_buckets(old_votes + votes);
+
+  if (old_votes > 0) {
+    unlink(index);
+  }
+
+  m_users[index].votes = old_votes + votes;
+  link(index);
+}
+
+void leaderboard::ingest(const topgg::voter& v) {
+  ingest(v.id);
+}
+
+size_t leaderboard::votes(const dpp::snowflake user_id) const noexcept {
+  std::lock_guard lock{m_mutex};
+  const auto s{find_slot(user_id)};
+
+  return s == nullptr ? 0 : m_users[s->index].votes;
+}
+
+std::optional<size_t> leaderboard::rank(const dpp::snowflake user_id) const noexcept {
+  std::lock_guard lock{m_mutex};
+  const auto s{find_slot(user_id)};
+
+  if (s == nullptr) {
+    return std::nullopt;
+  }
+
+  return std::optional{m_users.size() - tree_prefix(m_users[s->index].votes) + 1};
+}
+
+std::vector<leaderboard_entry> leaderboard::top(const size_t k) const {
+  std::lock_guard lock{m_mutex};
+  std::vector<leaderboard_entry> entries{};
+
+  if (m_users.empty() || k == 0) {
+    return entries;
+  }
+
+  entries.reserve(std::min(k, m_users.size()));
+
+  auto votes{m_highest};
+  size_t ahead{};
+
+  while (entries.size() < k) {
+    for (auto index{m_heads[votes]}; index != LEADERBOARD_NONE && entries.size() < k; index = m_users[index].next) {
+      entries.push_back(leaderboard_entry{dpp::snowflake{m_users[index].id}, votes, ahead + 1});
+    }
+
+    ahead += m_bucket_sizes[votes];
+
+    /**
+     * Jumps straight to the next non-empty bucket instead of walking every vote count in between.
+     */
+    const auto below{tree_prefix(votes - 1)};
+
+    if (below == 0) {
+      break;
+    }
+
+    votes = tree_find(below);
+  }
+
+  return entries;
+}
+
+size_t leaderboard::size() const noexcept {
+  std::lock_guard lock{m_mutex};
+
+  return m_users.size();
+}
+
+void leaderboard::reset() noexcept {
+  std::lock_guard lock{m_mutex};
+
+  reset_locked();
+}
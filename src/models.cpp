@@ -1,83 +1,34 @@
 #include <topgg/topgg.h>
 
 using topgg::account;
+using topgg::batch_bot;
 using topgg::bot;
+using topgg::bot_batch;
 using topgg::bot_query;
+using topgg::bot_table;
+using topgg::compiled_bot_query;
+using topgg::guild_counter;
+using topgg::internal_parser;
 using topgg::stats;
 using topgg::user;
 using topgg::user_socials;
-
-#ifdef _WIN32
-#include <sstream>
-#include <iomanip>
-
-static void strptime(const char* s, const char* f, tm* t) {
-  std::istringstream input{s};
-  input.imbue(std::locale{setlocale(LC_ALL, nullptr)});
-  input >> std::get_time(t, f);
-}
-
-#ifdef _MSC_VER
-#pragma warning(disable: 4101)
-#endif
-#endif
-
-#define SERIALIZE_PRIVATE_OPTIONAL(j, name) \
-  if (m_##name.has_value()) {               \
-    j[#name] = m_##name.value();            \
-  }
-
-#define DESERIALIZE(j, name, type) \
-  name = j[#name].template get<type>()
-
-#define DESERIALIZE_ALIAS(j, name, prop, type) \
-  prop = j[#name].template get<type>()
-
-#define IGNORE_EXCEPTION(scope) \
-  try scope catch (TOPGG_UNUSED const std::exception&) {}
-
-#define DESERIALIZE_VECTOR(j, name, type)                  \
-  IGNORE_EXCEPTION({                                       \
-    name = j[#name].template get<std::vector<type>>();     \
-  })
-
-#define DESERIALIZE_VECTOR_ALIAS(j, name, prop, type)      \
-  IGNORE_EXCEPTION({                                       \
-    prop = j[#name].template get<std::vector<type>>();     \
-  })
-
-#define DESERIALIZE_OPTIONAL(j, name, type)   \
-  IGNORE_EXCEPTION({                          \
-    name = j[#name].template get<type>();     \
-  })
-
-#define DESERIALIZE_PRIVATE_OPTIONAL(j, name, type)   \
-  IGNORE_EXCEPTION({                                  \
-    m_##name = j[#name].template get<type>();         \
-  })
-
-#define DESERIALIZE_OPTIONAL_ALIAS(j, name, prop) \
-  IGNORE_EXCEPTION({                              \
-    prop = j[#name].template get<type>();         \
-  })
-
-#define DESERIALIZE_OPTIONAL_STRING(j, name)                      \
-  IGNORE_EXCEPTION({                                              \
-    const auto value{j[#name].template get<std::string>()};       \
-                                                                  \
-    if (value.size() > 0) {                                       \
-      name = std::optional{value};                                \
-    }                                                             \
-  })
-
-#define DESERIALIZE_OPTIONAL_STRING_ALIAS(j, name, prop)          \
-  IGNORE_EXCEPTION({                                              \
-    const auto value{j[#name].template get<std::string>()};       \
-                                                                  \
-    if (value.size() > 0) {                                       \
-      prop = std::optional{value};                                \
-    }                                                             \
-  })
+using topgg::voter;
+
+#include <unordered_set>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <algorithm>
+#include <numeric>
+#include <charconv>
+#include <string_view>
+#include <cstring>
+#include <cstdio>
+#include <tuple>
 
 #define ADD_QUERY(key, value) \
   m_query.append(key);        \
@@ -91,92 +42,1452 @@ static void strptime(const char* s, const char* f, tm* t) {
   m_search.append(value);      \
   m_search.append("%20")
 
-account::account(const dpp::json& j) {
-  id = dpp::snowflake{j["id"].template get<std::string>()};
+/**
+ * Converts a proleptic Gregorian calendar date into days since the unix epoch, without going through the timezone database.
+ * See http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+ */
+static constexpr int64_t days_from_civil(int64_t year, const uint32_t month, const uint32_t day) noexcept {
+  year -= month <= 2;
 
-  DESERIALIZE(j, username, std::string);
+  const auto era{(year >= 0 ? year : year - 399) / 400};
+  const auto year_of_era{static_cast<uint32_t>(year - era * 400)};
+  const auto day_of_year{(153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1};
+  const auto day_of_era{year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year};
 
-  try {
-    const auto hash{j["avatar"].template get<std::string>()};
-    const char* ext{hash.rfind("a_", 0) == 0 ? "gif" : "png"};
+  return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+}
+
+/**
+ * The inverse of days_from_civil.
+ * See http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+ */
+static constexpr void civil_from_days(int64_t days, int64_t& year, uint32_t& month, uint32_t& day) noexcept {
+  days += 719468;
+
+  const auto era{(days >= 0 ? days : days - 146096) / 146097};
+  const auto day_of_era{static_cast<uint32_t>(days - era * 146097)};
+  const auto year_of_era{(day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365};
+  const auto day_of_year{day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100)};
+  const auto shifted_month{(5 * day_of_year + 2) / 153};
+
+  day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  year = static_cast<int64_t>(year_of_era) + era * 400 + (month <= 2);
+}
 
-    avatar = "https://cdn.discordapp.com/avatars/" + std::to_string(id) + "/" + hash + "." + ext + "?size=1024";
-  } catch (TOPGG_UNUSED const std::exception&) {
-    avatar = "https://cdn.discordapp.com/embed/avatars/" + std::to_string((id >> 22) % 6) + ".png";
+static constexpr uint32_t days_in_month(const uint32_t year, const uint32_t month) noexcept {
+  if (month == 2) {
+    return (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) ? 29 : 28;
   }
 
-  created_at = static_cast<time_t>(((id >> 22) / 1000) + 1420070400);
+  return month == 4 || month == 6 || month == 9 || month == 11 ? 30 : 31;
 }
 
-bot::bot(const dpp::json& j)
-  : account(j), url("https://top.gg/bot/") {
-  // TODO: remove this soon
-  discriminator = "0";
-  
-  DESERIALIZE(j, prefix, std::string);
-  DESERIALIZE_ALIAS(j, shortdesc, short_description, std::string);
-  DESERIALIZE_OPTIONAL_STRING_ALIAS(j, longdesc, long_description);
-  DESERIALIZE_VECTOR(j, tags, std::string);
-  DESERIALIZE_OPTIONAL_STRING(j, website);
-  DESERIALIZE_OPTIONAL_STRING(j, github);
+/**
+ * Reads a fixed amount of ASCII digits. Invalid digits are accumulated into a flag instead of branching on every character.
+ */
+static inline uint32_t fixed_digits(const char* input, const size_t length, bool& valid) noexcept {
+  uint32_t output{};
+
+  for (size_t i{}; i < length; i++) {
+    const auto digit{static_cast<uint32_t>(static_cast<unsigned char>(input[i])) - '0'};
+
+    valid &= digit <= 9;
+    output = output * 10 + digit;
+  }
 
-  IGNORE_EXCEPTION({
-    const auto j_owners{j["owners"].template get<std::vector<std::string>>()};
+  return output;
+}
+
+/**
+ * Parses an ISO 8601 UTC timestamp such as 2017-04-26T18:08:17.125Z into seconds and nanoseconds since the unix epoch.
+ * Fractional seconds of any precision and Z, +HH:MM, +HHMM or +HH offsets are accepted. A missing offset is treated as UTC.
+ */
+static bool parse_iso8601(const std::string_view value, int64_t& seconds, uint32_t& nanoseconds) noexcept {
+  if (value.size() < 19) {
+    return false;
+  }
+
+  const auto input{value.data()};
+  auto valid{input[4] == '-' && input[7] == '-' && (input[10] == 'T' || input[10] == 't' || input[10] == ' ') && input[13] == ':' && input[16] == ':'};
+
+  const auto year{fixed_digits(input, 4, valid)};
+  const auto month{fixed_digits(input + 5, 2, valid)};
+  const auto day{fixed_digits(input + 8, 2, valid)};
+  const auto hour{fixed_digits(input + 11, 2, valid)};
+  const auto minute{fixed_digits(input + 14, 2, valid)};
+  const auto second{fixed_digits(input + 17, 2, valid)};
+
+  valid &= (month - 1) < 12 && hour < 24 && minute < 60 && second <= 60;
+
+  if (!valid || (day - 1) >= days_in_month(year, month)) {
+    return false;
+  }
+
+  size_t position{19};
 
-    owners.reserve(j_owners.size());
+  nanoseconds = 0;
 
-    for (const auto& owner: j_owners) {
-      owners.push_back(dpp::snowflake{owner});
+  if (position < value.size() && (input[position] == '.' || input[position] == ',')) {
+    const auto start{++position};
+    uint32_t scale{100000000};
+
+    while (position < value.size() && static_cast<uint32_t>(static_cast<unsigned char>(input[position])) - '0' <= 9) {
+      // digits beyond nanosecond precision are consumed but dropped
+      nanoseconds += static_cast<uint32_t>(input[position] - '0') * scale;
+      scale /= 10;
+      position++;
     }
-  });
 
-  DESERIALIZE_OPTIONAL_STRING_ALIAS(j, bannerUrl, banner);
+    if (position == start) {
+      return false;
+    }
+  }
+
+  int64_t offset{};
+
+  if (position < value.size()) {
+    const auto sign{input[position++]};
+
+    if (sign == '+' || sign == '-') {
+      const auto rest{value.size() - position};
+
+      if (rest != 2 && rest != 4 && !(rest == 5 && input[position + 2] == ':')) {
+        return false;
+      }
+
+      const auto offset_hours{fixed_digits(input + position, 2, valid)};
+      const auto offset_minutes{rest == 2 ? 0 : fixed_digits(input + position + (rest == 5 ? 3 : 2), 2, valid)};
+
+      if (!valid || offset_hours > 23 || offset_minutes > 59) {
+        return false;
+      }
+
+      offset = (sign == '+' ? 1 : -1) * static_cast<int64_t>(offset_hours * 3600 + offset_minutes * 60);
+    } else if ((sign != 'Z' && sign != 'z') || position != value.size()) {
+      return false;
+    }
+  }
+
+  seconds = days_from_civil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset;
+
+  return true;
+}
+
+/**
+ * Formats a unix timestamp the same way Top.gg formats its own timestamps.
+ */
+static void format_iso8601(const time_t value, char (&output)[32]) noexcept {
+  const auto timestamp{static_cast<int64_t>(value)};
+  auto days{timestamp / 86400}, seconds_of_day{timestamp % 86400};
+
+  if (seconds_of_day < 0) {
+    seconds_of_day += 86400;
+    days--;
+  }
+
+  int64_t year{};
+  uint32_t month{}, day{};
+
+  civil_from_days(days, year, month, day);
+
+  snprintf(output, sizeof(output), "%04lld-%02u-%02uT%02u:%02u:%02u.000Z", static_cast<long long>(year), month, day, static_cast<uint32_t>(seconds_of_day / 3600), static_cast<uint32_t>(seconds_of_day / 60 % 60), static_cast<uint32_t>(seconds_of_day % 60));
+}
+
+static dpp::snowflake parse_snowflake(const std::string& value) noexcept {
+  uint64_t id{};
+
+  std::from_chars(value.data(), value.data() + value.size(), id);
+
+  return dpp::snowflake{id};
+}
+
+/**
+ * The path of a scalar value relative to the model object it belongs to.
+ */
+struct sax_path {
+  /**
+   * The key of the model's field.
+   */
+  std::string_view key;
+
+  /**
+   * The key inside a nested object such as a user's socials, empty otherwise.
+   */
+  std::string_view subkey;
+
+  /**
+   * Whether this value is an element of an array such as a bot's tags.
+   */
+  bool in_array;
+};
+
+/**
+ * Describes a single JSON field of a model at compile time: its JSON key, the member it maps to and the converter used to read and write it.
+ */
+template<typename Conv, typename C, typename M>
+struct field_descriptor {
+  using converter = Conv;
+
+  const char* name;
+  M C::*member;
+};
+
+template<typename Conv, typename C, typename M>
+constexpr field_descriptor<Conv, C, M> field_with(const char* name, M C::*member) noexcept {
+  return field_descriptor<Conv, C, M>{name, member};
+}
+
+/**
+ * Converts plain JSON values. Every read checks the value's type first, so a missing or mistyped field leaves the member untouched instead of throwing.
+ */
+struct value_field {
+  static void read(const dpp::json& j, std::string& output) {
+    if (j.is_string()) {
+      output = j.template get_ref<const std::string&>();
+    }
+  }
+
+  static void read(const dpp::json& j, std::optional<std::string>& output) {
+    if (j.is_string() && !j.template get_ref<const std::string&>().empty()) {
+      output = std::optional{j.template get_ref<const std::string&>()};
+    }
+  }
+
+  static void read(const dpp::json& j, std::vector<std::string>& output) {
+    if (j.is_array()) {
+      output.reserve(j.size());
+
+      for (const auto& part: j) {
+        if (part.is_string()) {
+          output.push_back(part.template get_ref<const std::string&>());
+        }
+      }
+    }
+  }
+
+  static void read(const dpp::json& j, dpp::snowflake& output) noexcept {
+    if (j.is_string()) {
+      output = parse_snowflake(j.template get_ref<const std::string&>());
+    }
+  }
+
+  static void read(const dpp::json& j, std::vector<dpp::snowflake>& output) {
+    if (j.is_array()) {
+      output.reserve(j.size());
+
+      for (const auto& part: j) {
+        if (part.is_string()) {
+          output.push_back(parse_snowflake(part.template get_ref<const std::string&>()));
+        }
+      }
+    }
+  }
+
+  static void read(const dpp::json& j, size_t& output) noexcept {
+    if (j.is_number_unsigned()) {
+      output = j.template get<size_t>();
+    }
+  }
+
+  static void read(const dpp::json& j, std::optional<size_t>& output) noexcept {
+    if (j.is_number_unsigned()) {
+      output = std::optional{j.template get<size_t>()};
+    }
+  }
+
+  static void read(const dpp::json& j, bool& output) noexcept {
+    if (j.is_boolean()) {
+      output = j.template get<bool>();
+    }
+  }
+
+  static void set(std::string& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    output = value;
+  }
+
+  static void set(std::optional<std::string>& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    if (!value.empty()) {
+      output = std::optional{value};
+    }
+  }
+
+  static void set(std::vector<std::string>& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    output.push_back(value);
+  }
+
+  static void set(std::pmr::string& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    output.assign(value);
+  }
+
+  static void set(dpp::snowflake& output, TOPGG_UNUSED const sax_path& path, const std::string& value) noexcept {
+    output = parse_snowflake(value);
+  }
+
+  static void set(std::vector<dpp::snowflake>& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    output.push_back(parse_snowflake(value));
+  }
+
+  static void set(std::pmr::vector<dpp::snowflake>& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    output.push_back(parse_snowflake(value));
+  }
+
+  static void set(size_t& output, TOPGG_UNUSED const sax_path& path, const uint64_t value) noexcept {
+    output = static_cast<size_t>(value);
+  }
+
+  static void set(std::optional<size_t>& output, TOPGG_UNUSED const sax_path& path, const uint64_t value) noexcept {
+    output = std::optional{static_cast<size_t>(value)};
+  }
+
+  static void set(bool& output, TOPGG_UNUSED const sax_path& path, const bool value) noexcept {
+    output = value;
+  }
+
+  template<typename M, typename V>
+  static void set(TOPGG_UNUSED M& output, TOPGG_UNUSED const sax_path& path, TOPGG_UNUSED const V& value) noexcept {}
+
+  template<typename M>
+  static void write(dpp::json& j, const char* name, const M& value) {
+    j[name] = value;
+  }
+
+  template<typename M>
+  static void write(dpp::json& j, const char* name, const std::optional<M>& value) {
+    if (value.has_value()) {
+      j[name] = value.value();
+    }
+  }
+
+  static void write(dpp::json& j, const char* name, const dpp::snowflake value) {
+    j[name] = std::to_string(value);
+  }
+
+  static void write(dpp::json& j, const char* name, const std::vector<dpp::snowflake>& value) {
+    auto& output{j[name] = dpp::json::array()};
+
+    for (const auto id: value) {
+      output.push_back(std::to_string(id));
+    }
+  }
+};
+
+/**
+ * Converts ISO 8601 date strings into unix timestamps.
+ */
+struct timestamp_field {
+  static void read(const dpp::json& j, time_t& output) {
+    if (j.is_string()) {
+      output = internal_parser::parse_timestamp(j.template get_ref<const std::string&>());
+    }
+  }
+
+  static void set(time_t& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    output = internal_parser::parse_timestamp(value);
+  }
+
+  template<typename V>
+  static void set(TOPGG_UNUSED time_t& output, TOPGG_UNUSED const sax_path& path, TOPGG_UNUSED const V& value) noexcept {}
+
+  static void write(dpp::json& j, const char* name, const time_t value) {
+    char output[32]{};
 
-  const auto j_approved_at{j["date"].template get<std::string>()};
-  tm approved_at_tm;
+    format_iso8601(value, output);
 
-  strptime(j_approved_at.data(), "%Y-%m-%dT%H:%M:%S", &approved_at_tm);
-  approved_at = mktime(&approved_at_tm);
+    j[name] = output;
+  }
+};
+
+template<typename T, typename Conv, typename C, typename M>
+static void read_field(const dpp::json& j, T& output, const field_descriptor<Conv, C, M>& descriptor) {
+  const auto it{j.find(descriptor.name)};
+
+  if (it != j.end()) {
+    Conv::read(*it, output.*(descriptor.member));
+  }
+}
+
+template<typename T, typename Table>
+static void read_fields(const dpp::json& j, T& output, const Table& table) {
+  std::apply([&j, &output](const auto&... descriptors) { (read_field(j, output, descriptors), ...); }, table);
+}
 
+template<typename T, typename V, typename Conv, typename C, typename M>
+static bool set_field(T& output, const sax_path& path, const V& value, const field_descriptor<Conv, C, M>& descriptor) {
+  if (path.key != descriptor.name) {
+    return false;
+  }
+
+  Conv::set(output.*(descriptor.member), path, value);
+  return true;
+}
+
+template<typename T, typename V, typename Table>
+static bool set_fields(T& output, const sax_path& path, const V& value, const Table& table) {
+  return std::apply([&output, &path, &value](const auto&... descriptors) { return (set_field(output, path, value, descriptors) || ...); }, table);
+}
+
+template<typename T, typename Conv, typename C, typename M>
+static void write_field(dpp::json& j, const T& input, const field_descriptor<Conv, C, M>& descriptor) {
+  Conv::write(j, descriptor.name, input.*(descriptor.member));
+}
+
+/**
+ * Describes a boolean JSON field whose member is a bit-field, which a member pointer can't point to.
+ */
+template<typename C>
+struct flag_descriptor {
+  const char* name;
+  bool (*get)(const C&) noexcept;
+  void (*set)(C&, const bool) noexcept;
+};
+
+#define FLAG_FIELD(C, name, member)                                         \
+  flag_descriptor<C>{                                                       \
+    name,                                                                   \
+    [](const C& input) noexcept -> bool { return input.member; },           \
+    [](C& output, const bool value) noexcept { output.member = value; }     \
+  }
+
+template<typename T, typename C>
+static void read_field(const dpp::json& j, T& output, const flag_descriptor<C>& descriptor) {
+  const auto it{j.find(descriptor.name)};
+
+  if (it != j.end() && it->is_boolean()) {
+    descriptor.set(output, it->template get<bool>());
+  }
+}
+
+template<typename T, typename V, typename C>
+static bool set_field(T& output, const sax_path& path, const V& value, const flag_descriptor<C>& descriptor) {
+  if (path.key != descriptor.name) {
+    return false;
+  }
+
+  if constexpr (std::is_same_v<V, bool>) {
+    descriptor.set(output, value);
+  }
+
+  return true;
+}
+
+template<typename T, typename C>
+static void write_field(dpp::json& j, const T& input, const flag_descriptor<C>& descriptor) {
+  j[descriptor.name] = descriptor.get(input);
+}
+
+template<typename T, typename Table>
+static void write_fields(dpp::json& j, const T& input, const Table& table) {
+  std::apply([&j, &input](const auto&... descriptors) { (write_field(j, input, descriptors), ...); }, table);
+}
+
+template<typename C, typename M>
+constexpr field_descriptor<value_field, C, M> field(const char* name, M C::*member) noexcept {
+  return field_descriptor<value_field, C, M>{name, member};
+}
+
+/**
+ * Marks the start of a nested object under a model's field, before any of its values are read.
+ */
+struct sax_object_start {};
+
+/**
+ * Converts nested objects such as a user's socials through their own field table.
+ */
+struct internal_parser::nested_field {
+  template<typename M>
+  static void read(const dpp::json& j, std::optional<M>& output) {
+    if (j.is_object()) {
+      M value{};
+
+      read_fields(j, value, fields<M>::value);
+      output = std::optional{std::move(value)};
+    }
+  }
+
+  // an empty object still counts as present, like it does when reading from a DOM
+  template<typename M>
+  static void set(std::optional<M>& output, TOPGG_UNUSED const sax_path& path, TOPGG_UNUSED const sax_object_start& value) {
+    if (!output.has_value()) {
+      output = std::optional{M{}};
+    }
+  }
+
+  template<typename M, typename V>
+  static void set(std::optional<M>& output, const sax_path& path, const V& value) {
+    if (path.subkey.empty()) {
+      return;
+    } else if (!output.has_value()) {
+      output = std::optional{M{}};
+    }
+
+    set_fields(output.value(), sax_path{path.subkey, {}, path.in_array}, value, fields<M>::value);
+  }
+
+  template<typename M>
+  static void write(dpp::json& j, const char* name, const std::optional<M>& value) {
+    if (value.has_value()) {
+      write_fields(j[name] = dpp::json::object(), value.value(), fields<M>::value);
+    }
+  }
+};
+
+/**
+ * A monotonic arena that also interns strings, so that repeated strings across a batch are only stored once.
+ */
+class bot_batch::arena: public std::pmr::monotonic_buffer_resource {
+  std::pmr::unordered_set<std::string_view> m_strings;
+
+public:
+  inline arena(const size_t initial_size)
+    : std::pmr::monotonic_buffer_resource(initial_size), m_strings(this) {}
+
+  std::string_view intern(const std::string& value) {
+    const auto existing{m_strings.find(std::string_view{value})};
+
+    if (existing != m_strings.end()) {
+      return *existing;
+    }
+
+    auto data{static_cast<char*>(allocate(value.size() + 1, alignof(char)))};
+
+    memcpy(data, value.data(), value.size());
+    data[value.size()] = '\0';
+
+    return *m_strings.insert(std::string_view{data, value.size()}).first;
+  }
+
+  inline size_t size() const noexcept {
+    return m_strings.size();
+  }
+};
+
+/**
+ * Converts arrays of strings into interned string views, allocating from the arena that owns the array.
+ */
+struct internal_parser::interned_field {
+  static void set(std::pmr::vector<std::string_view>& output, TOPGG_UNUSED const sax_path& path, const std::string& value) {
+    auto resource{static_cast<bot_batch::arena*>(output.get_allocator().resource())};
+
+    output.push_back(resource->intern(value));
+  }
+
+  template<typename V>
+  static void set(TOPGG_UNUSED std::pmr::vector<std::string_view>& output, TOPGG_UNUSED const sax_path& path, TOPGG_UNUSED const V& value) noexcept {}
+};
+
+template<>
+struct internal_parser::fields<account> {
+  static constexpr auto value = std::make_tuple(
+    field("id", &account::id),
+    field("username", &account::username),
+    field("avatar", &account::avatar)
+  );
+};
+
+template<>
+struct internal_parser::fields<voter> {
+  static constexpr auto value = fields<account>::value;
+};
+
+template<>
+struct internal_parser::fields<bot> {
+  static constexpr auto value = std::tuple_cat(fields<account>::value, std::make_tuple(
+    field("prefix", &bot::prefix),
+    field("shortdesc", &bot::short_description),
+    field("longdesc", &bot::long_description),
+    field("tags", &bot::tags),
+    field("website", &bot::website),
+    field("github", &bot::github),
+    field("owners", &bot::owners),
+    field("bannerUrl", &bot::banner),
+    field_with<timestamp_field>("date", &bot::approved_at),
+    field("points", &bot::votes),
+    field("monthlyPoints", &bot::monthly_votes),
+    field("support", &bot::support),
+    field("invite", &bot::invite),
+    field("vanity", &bot::url)
+  ));
+};
+
+template<>
+struct internal_parser::fields<batch_bot> {
+  static constexpr auto value = std::make_tuple(
+    field("id", &batch_bot::id),
+    field("username", &batch_bot::username),
+    field("avatar", &batch_bot::avatar),
+    field("prefix", &batch_bot::prefix),
+    field("shortdesc", &batch_bot::short_description),
+    field("longdesc", &batch_bot::long_description),
+    field_with<interned_field>("tags", &batch_bot::tags),
+    field("website", &batch_bot::website),
+    field("github", &batch_bot::github),
+    field("owners", &batch_bot::owners),
+    field("bannerUrl", &batch_bot::banner),
+    field_with<timestamp_field>("date", &batch_bot::approved_at),
+    field("points", &batch_bot::votes),
+    field("monthlyPoints", &batch_bot::monthly_votes),
+    field("support", &batch_bot::support),
+    field("invite", &batch_bot::invite),
+    field("vanity", &batch_bot::url)
+  );
+};
+
+/**
+ * A single bot's worth of the columns in a bot_table, reused for every row while parsing.
+ */
+struct internal_parser::table_row {
+  dpp::snowflake id;
+  std::string username;
+  std::vector<std::string> tags;
+  time_t approved_at;
+  size_t votes;
+  size_t monthly_votes;
+
+  friend void finish(const table_row& r) {
+    if (r.id == 0) {
+      throw std::runtime_error{"Missing account ID."};
+    }
+  }
+};
+
+template<>
+struct internal_parser::fields<internal_parser::table_row> {
+  static constexpr auto value = std::make_tuple(
+    field("id", &table_row::id),
+    field("username", &table_row::username),
+    field("tags", &table_row::tags),
+    field_with<timestamp_field>("date", &table_row::approved_at),
+    field("points", &table_row::votes),
+    field("monthlyPoints", &table_row::monthly_votes)
+  );
+};
+
+template<>
+struct internal_parser::fields<user_socials> {
+  static constexpr auto value = std::make_tuple(
+    field("github", &user_socials::github),
+    field("instagram", &user_socials::instagram),
+    field("reddit", &user_socials::reddit),
+    field("twitter", &user_socials::twitter),
+    field("youtube", &user_socials::youtube)
+  );
+};
+
+template<>
+struct internal_parser::fields<user> {
+  static constexpr auto value = std::tuple_cat(fields<account>::value, std::make_tuple(
+    field("bio", &user::bio),
+    field("banner", &user::banner),
+    field_with<nested_field>("socials", &user::socials),
+#ifdef TOPGG_LEAN_MODELS
+    FLAG_FIELD(user, "supporter", is_supporter),
+    FLAG_FIELD(user, "mod", is_moderator),
+    FLAG_FIELD(user, "webMod", is_web_moderator),
+    FLAG_FIELD(user, "admin", is_admin)
+#else
+    field("supporter", &user::is_supporter),
+    field("mod", &user::is_moderator),
+    field("webMod", &user::is_web_moderator),
+    field("admin", &user::is_admin)
+#endif
+  ));
+};
+
+template<>
+struct internal_parser::fields<stats> {
+  static constexpr auto value = std::make_tuple(
+    field("server_count", &stats::m_server_count)
+  );
+};
+
+/**
+ * Builds the fields derived from other fields once every field of a model has been read.
+ */
+static void finish(account& a) {
+  if (a.id == 0) {
+    throw std::runtime_error{"Missing account ID."};
+  }
+
+  if (a.avatar.empty()) {
+    a.avatar = "https://cdn.discordapp.com/embed/avatars/" + std::to_string((a.id >> 22) % 6) + ".png";
+  } else {
+    // at this point this is only the avatar hash
+    const char* ext{a.avatar.rfind("a_", 0) == 0 ? "gif" : "png"};
+
+    a.avatar = "https://cdn.discordapp.com/avatars/" + std::to_string(a.id) + "/" + a.avatar + "." + ext + "?size=1024";
+  }
+
+  a.created_at = static_cast<time_t>(((a.id >> 22) / 1000) + 1420070400);
+}
+
+static void finish(bot& b) {
+  finish(static_cast<account&>(b));
+
+#ifndef TOPGG_LEAN_MODELS
   // TODO: remove this soon
-  is_certified = false;
+  b.discriminator = "0";
+#endif
 
-  DESERIALIZE_ALIAS(j, points, votes, size_t);
-  DESERIALIZE_ALIAS(j, monthlyPoints, monthly_votes, size_t);
+  if (b.invite.empty()) {
+    b.invite = "https://discord.com/oauth2/authorize?scope=bot&client_id=" + std::to_string(b.id);
+  }
+
+  if (b.support.has_value()) {
+    b.support.value().insert(0, "https://discord.com/invite/");
+  }
+
+  // at this point this is only the vanity, if any
+  b.url.insert(0, "https://top.gg/bot/");
+
+  if (b.url.size() == 19) {
+    b.url.append(std::to_string(b.id));
+  }
+}
+
+static void finish(batch_bot& b) {
+  if (b.id == 0) {
+    throw std::runtime_error{"Missing account ID."};
+  }
+
+  char id_buffer[24]{};
+  const std::string_view id{id_buffer, static_cast<size_t>(std::to_chars(id_buffer, id_buffer + sizeof(id_buffer), static_cast<uint64_t>(b.id)).ptr - id_buffer)};
+  const auto alloc{b.avatar.get_allocator()};
+
+  if (b.avatar.empty()) {
+    b.avatar.append("https://cdn.discordapp.com/embed/avatars/");
+    b.avatar.push_back(static_cast<char>('0' + ((b.id >> 22) % 6)));
+    b.avatar.append(".png");
+  } else {
+    // at this point this is only the avatar hash
+    const auto animated{b.avatar.rfind("a_", 0) == 0};
+    std::pmr::string avatar{alloc};
+
+    avatar.reserve(64 + b.avatar.size());
+    avatar.append("https://cdn.discordapp.com/avatars/").append(id).push_back('/');
+    avatar.append(b.avatar).append(animated ? ".gif" : ".png").append("?size=1024");
+    b.avatar.swap(avatar);
+  }
+
+  b.created_at = static_cast<time_t>(((b.id >> 22) / 1000) + 1420070400);
 
-  try {
-    DESERIALIZE(j, invite, std::string);
-  } catch (TOPGG_UNUSED const std::exception&) {
-    invite = "https://discord.com/oauth2/authorize?scope=bot&client_id=" + std::to_string(id);
+  if (b.invite.empty()) {
+    b.invite.append("https://discord.com/oauth2/authorize?scope=bot&client_id=").append(id);
   }
 
-  IGNORE_EXCEPTION({
-    const auto j_support{j["support"].template get<std::string>()};
+  if (!b.support.empty()) {
+    b.support.insert(0, "https://discord.com/invite/");
+  }
+
+  // at this point this is only the vanity, if any
+  b.url.insert(0, "https://top.gg/bot/");
+
+  if (b.url.size() == 19) {
+    b.url.append(id);
+  }
+}
 
-    if (j_support.size() > 0) {
-      support = std::optional{"https://discord.com/invite/" + j_support};
+static void finish(TOPGG_UNUSED user_socials& s) noexcept {}
+
+static void finish(TOPGG_UNUSED stats& s) noexcept {}
+
+/**
+ * A nlohmann SAX handler that writes scalar values straight into model objects as the lexer emits them.
+ * Keys are kept in small reusable buffers and values under unknown keys are dropped, so no DOM is ever built.
+ */
+template<typename T, typename Container>
+class internal_parser::reader {
+  Container* m_output;
+  T* m_current;
+  const char* m_container_key;
+  std::string m_root_key;
+  std::string m_key;
+  std::string m_subkey;
+  size_t m_depth;
+  size_t m_element_depth;
+  bool m_in_element;
+  bool m_nested_array;
+
+  template<typename V>
+  inline bool value(const V& v) {
+    if (m_in_element) {
+      if (m_depth == m_element_depth) {
+        set_fields(*m_current, sax_path{m_key, {}, false}, v, fields<T>::value);
+      } else if (m_depth == m_element_depth + 1) {
+        set_fields(*m_current, sax_path{m_key, m_nested_array ? std::string_view{} : std::string_view{m_subkey}, m_nested_array}, v, fields<T>::value);
+      }
+    }
+
+    return true;
+  }
+
+public:
+  inline reader(T& output)
+    : m_output(nullptr), m_current(&output), m_container_key(nullptr), m_depth(0), m_element_depth(1), m_in_element(false), m_nested_array(false) {}
+
+  inline reader(Container& output, const char* container_key)
+    : m_output(&output), m_current(nullptr), m_container_key(container_key), m_depth(0), m_element_depth(container_key == nullptr ? 2 : 3), m_in_element(false), m_nested_array(false) {}
+
+  inline bool null() noexcept {
+    return true;
+  }
+
+  inline bool boolean(const bool val) {
+    return value(val);
+  }
+
+  inline bool number_integer(const dpp::json::number_integer_t val) {
+    return value(static_cast<uint64_t>(val < 0 ? 0 : val));
+  }
+
+  inline bool number_unsigned(const dpp::json::number_unsigned_t val) {
+    return value(static_cast<uint64_t>(val));
+  }
+
+  inline bool number_float(TOPGG_UNUSED const dpp::json::number_float_t, TOPGG_UNUSED const dpp::json::string_t&) noexcept {
+    return true;
+  }
+
+  inline bool string(dpp::json::string_t& val) {
+    return value(val);
+  }
+
+  inline bool binary(TOPGG_UNUSED dpp::json::binary_t&) noexcept {
+    return true;
+  }
+
+  bool start_object(TOPGG_UNUSED const size_t elements) {
+    if (!m_in_element && m_depth + 1 == m_element_depth) {
+      if (m_output != nullptr) {
+        if (m_container_key != nullptr && m_root_key != m_container_key) {
+          m_depth++;
+          return true;
+        }
+
+        if constexpr (std::uses_allocator_v<T, typename Container::allocator_type>) {
+          m_current = &m_output->emplace_back();
+        } else {
+          m_output->push_back(T{});
+          m_current = &m_output->back();
+        }
+      }
+
+      m_in_element = true;
+    } else if (m_in_element && m_depth == m_element_depth) {
+      m_nested_array = false;
+      m_subkey.clear();
+
+      set_fields(*m_current, sax_path{m_key, {}, false}, sax_object_start{}, fields<T>::value);
+    }
+
+    m_depth++;
+    return true;
+  }
+
+  bool end_object() {
+    m_depth--;
+
+    if (m_in_element && m_depth + 1 == m_element_depth) {
+      finish(*m_current);
+      m_in_element = false;
+    }
+
+    return true;
+  }
+
+  inline bool start_array(TOPGG_UNUSED const size_t elements) noexcept {
+    if (m_in_element && m_depth == m_element_depth) {
+      m_nested_array = true;
+    }
+
+    m_depth++;
+    return true;
+  }
+
+  inline bool end_array() noexcept {
+    m_depth--;
+    return true;
+  }
+
+  bool key(dpp::json::string_t& val) {
+    if (m_in_element) {
+      if (m_depth == m_element_depth) {
+        m_key.assign(val);
+      } else if (m_depth == m_element_depth + 1) {
+        m_subkey.assign(val);
+      }
+    } else if (m_depth == 1) {
+      m_root_key.assign(val);
+    }
+
+    return true;
+  }
+
+  /**
+   * nlohmann reports its errors through their base class, rethrow the concrete type instead of a sliced copy.
+   */
+  [[noreturn]] bool parse_error(TOPGG_UNUSED const size_t position, TOPGG_UNUSED const std::string& last_token, const dpp::json::exception& ex) {
+    if (const auto error{dynamic_cast<const dpp::json::parse_error*>(&ex)}; error != nullptr) {
+      throw *error;
+    } else if (const auto error{dynamic_cast<const dpp::json::out_of_range*>(&ex)}; error != nullptr) {
+      throw *error;
+    }
+
+    throw std::runtime_error{ex.what()};
+  }
+};
+
+template<typename T>
+T internal_parser::parse(const std::string& body) {
+  T output{};
+  reader<T, std::vector<T>> handler{output};
+
+  dpp::json::sax_parse(body, &handler);
+
+  return output;
+}
+
+template<typename T>
+std::vector<T> internal_parser::parse_array(const std::string& body, const char* key) {
+  std::vector<T> output{};
+  reader<T, std::vector<T>> handler{output, key};
+
+  dpp::json::sax_parse(body, &handler);
+
+  return output;
+}
+
+/**
+ * A process-wide pool of parser threads, shared by every client in the process.
+ * Threads are only started once a list is parsed in parallel, and only as many as that list asked for. They then stay idle until the process exits, when the pool's destructor joins them.
+ * The calling thread always takes part in the work, so a list parsed on n threads only needs n - 1 of the pool's threads.
+ */
+class parse_pool {
+  std::vector<std::thread> m_threads;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stopping;
+
+  void work() {
+    while (true) {
+      std::function<void()> task{};
+
+      {
+        std::unique_lock lock{m_mutex};
+
+        m_condition.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+
+        if (m_tasks.empty()) {
+          return;
+        }
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+
+      task();
+    }
+  }
+
+  parse_pool()
+    : m_stopping(false) {}
+
+public:
+  ~parse_pool() {
+    {
+      std::lock_guard lock{m_mutex};
+      m_stopping = true;
+    }
+
+    m_condition.notify_all();
+
+    for (auto& thread: m_threads) {
+      thread.join();
+    }
+  }
+
+  static parse_pool& instance() {
+    static parse_pool pool{};
+
+    return pool;
+  }
+
+  /**
+   * Starts threads until the pool has at least the given amount.
+   */
+  void grow(const size_t threads) {
+    std::lock_guard lock{m_mutex};
+
+    while (m_threads.size() < threads) {
+      m_threads.emplace_back(&parse_pool::work, this);
+    }
+  }
+
+  /**
+   * Calls fn(i) for every i in [0, count) on up to the given amount of the pool's threads and the calling thread, then waits for every helper to leave.
+   */
+  template<typename F>
+  void for_each(const size_t count, const size_t max_helpers, F&& fn) {
+    grow(max_helpers);
+
+    const auto helpers{std::min(max_helpers, count - 1)};
+    const auto chunk{std::max<size_t>(count / ((helpers + 1) * 4), 1)};
+    std::atomic_size_t next{};
+    size_t remaining_helpers{helpers};
+    std::mutex done_mutex{};
+    std::condition_variable done{};
+
+    const auto run{[&]() {
+      for (auto begin{next.fetch_add(chunk)}; begin < count; begin = next.fetch_add(chunk)) {
+        for (auto i{begin}, end{std::min(begin + chunk, count)}; i < end; i++) {
+          fn(i);
+        }
+      }
+    }};
+
+    if (helpers != 0) {
+      {
+        std::lock_guard lock{m_mutex};
+
+        for (size_t i{}; i < helpers; i++) {
+          m_tasks.emplace_back([&]() {
+            run();
+
+            std::lock_guard done_lock{done_mutex};
+
+            if (--remaining_helpers == 0) {
+              done.notify_one();
+            }
+          });
+        }
+      }
+
+      m_condition.notify_all();
+    }
+
+    run();
+
+    std::unique_lock done_lock{done_mutex};
+    done.wait(done_lock, [&]() { return remaining_helpers == 0; });
+  }
+};
+
+static constexpr size_t PARALLEL_PARSE_MIN_ELEMENTS = 32;
+
+/**
+ * Skips past a JSON string whose opening quote is at position, returning the position after its closing quote.
+ */
+static size_t skip_json_string(const std::string& body, size_t position) noexcept {
+  while (true) {
+    position = body.find_first_of("\"\\", position + 1);
+
+    if (position == std::string::npos) {
+      return position;
+    } else if (body[position] == '"') {
+      return position + 1;
+    }
+
+    // skip the escaped character
+    position++;
+  }
+}
+
+/**
+ * Finds the boundaries of every object element of the list in one pass, without deserializing anything.
+ * Returns false if the list could not be located, so that the caller can fall back to the regular parser.
+ */
+static bool find_elements(const std::string& body, const char* key, std::vector<std::pair<size_t, size_t>>& elements) {
+  size_t depth{}, position{}, element_start{};
+  const auto key_length{key == nullptr ? 0 : strlen(key)};
+  const size_t list_depth = key == nullptr ? 1 : 2;
+  auto in_list{key == nullptr};
+
+  while (position < body.size()) {
+    const auto c{body[position]};
+
+    switch (c) {
+      case '"': {
+        const auto end{skip_json_string(body, position)};
+
+        if (end == std::string::npos) {
+          return false;
+        }
+
+        // a root key, see if it's the list's key and if the list follows it
+        if (!in_list && depth == 1 && end - position - 2 == key_length && body.compare(position + 1, key_length, key) == 0) {
+          const auto value{body.find_first_not_of(" \t\r\n", end)};
+
+          if (value != std::string::npos && body[value] == ':') {
+            const auto list{body.find_first_not_of(" \t\r\n", value + 1)};
+
+            in_list = list != std::string::npos && body[list] == '[';
+          }
+        }
+
+        position = end;
+        continue;
+      }
+
+      case '{':
+      case '[':
+        if (in_list && depth == list_depth && c == '{') {
+          element_start = position;
+        }
+
+        depth++;
+        break;
+
+      case '}':
+      case ']':
+        if (depth == 0) {
+          return false;
+        }
+
+        depth--;
+
+        if (in_list && depth == list_depth && c == '}') {
+          elements.emplace_back(element_start, position + 1);
+        } else if (in_list && depth + 1 == list_depth) {
+          // the list itself was closed
+          return true;
+        }
+
+        break;
+    }
+
+    position++;
+  }
+
+  return false;
+}
+
+template<typename T>
+std::vector<T> internal_parser::parse_array_parallel(const std::string& body, const char* key, size_t threads) {
+  std::vector<std::pair<size_t, size_t>> elements{};
+
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+
+  if (threads <= 1 || body.size() < PARALLEL_PARSE_MIN_ELEMENTS * 64 || !find_elements(body, key, elements) || elements.size() < PARALLEL_PARSE_MIN_ELEMENTS) {
+    return parse_array<T>(body, key);
+  }
+
+  std::vector<T> output{};
+  std::exception_ptr error{};
+  std::mutex error_mutex{};
+
+  output.reserve(elements.size());
+
+  for (size_t i{}; i < elements.size(); i++) {
+    output.push_back(T{});
+  }
+
+  parse_pool::instance().for_each(elements.size(), threads - 1, [&](const size_t i) {
+    try {
+      reader<T, std::vector<T>> handler{output[i]};
+
+      dpp::json::sax_parse(body.begin() + static_cast<ptrdiff_t>(elements[i].first), body.begin() + static_cast<ptrdiff_t>(elements[i].second), &handler);
+    } catch (...) {
+      std::lock_guard lock{error_mutex};
+
+      if (!error) {
+        error = std::current_exception();
+      }
     }
   });
 
-  // TODO: remove this soon
-  shard_count = 0;
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  return output;
+}
 
-  try {
-    url.append(j["vanity"].template get<std::string>());
-  } catch (TOPGG_UNUSED const std::exception&) {
-    url.append(std::to_string(id));
+bot_batch internal_parser::parse_batch(const std::string& body, const char* key) {
+  // most of the batch's strings are copied from the body, so the body's size is a good estimate of the arena's size
+  bot_batch output{body.size()};
+  reader<batch_bot, std::pmr::vector<batch_bot>> handler{output.m_bots, key};
+
+  dpp::json::sax_parse(body, &handler);
+
+  return output;
+}
+
+/**
+ * Stands in for the reader's container, appending every finished row straight into the table's columns.
+ * Only one row is ever alive, so its buffers are reused across the whole list.
+ */
+class internal_parser::table_builder {
+  bot_table& m_table;
+  table_row m_row;
+  std::unordered_map<std::string, uint32_t> m_tag_codes;
+  bool m_pending;
+
+  void flush() {
+    if (!m_pending) {
+      return;
+    }
+
+    m_table.m_ids.push_back(m_row.id);
+    m_table.m_usernames.push_back(std::move(m_row.username));
+    m_table.m_votes.push_back(m_row.votes);
+    m_table.m_monthly_votes.push_back(m_row.monthly_votes);
+    m_table.m_approved_at.push_back(m_row.approved_at);
+
+    const auto row{static_cast<uint32_t>(m_table.m_ids.size() - 1)};
+    const auto row_begin{static_cast<ptrdiff_t>(m_table.m_tag_offsets.back())};
+
+    for (auto& tag: m_row.tags) {
+      const auto code{m_tag_codes.try_emplace(tag, static_cast<uint32_t>(m_table.m_tag_dictionary.size()))};
+
+      if (code.second) {
+        m_table.m_tag_dictionary.push_back(std::move(tag));
+      } else if (std::find(m_table.m_tag_codes.begin() + row_begin, m_table.m_tag_codes.end(), code.first->second) != m_table.m_tag_codes.end()) {
+        // a repeated tag would make filter_tag return its row twice
+        continue;
+      }
+
+      m_table.m_tag_codes.push_back(code.first->second);
+      m_table.m_tag_rows.push_back(row);
+    }
+
+    m_table.m_tag_offsets.push_back(static_cast<uint32_t>(m_table.m_tag_codes.size()));
+    m_pending = false;
+  }
+
+public:
+  using allocator_type = std::allocator<table_row>;
+
+  inline table_builder(bot_table& table)
+    : m_table(table), m_row(), m_pending(false) {}
+
+  void push_back(TOPGG_UNUSED table_row&& row) {
+    flush();
+
+    m_row.id = 0;
+    m_row.username.clear();
+    m_row.tags.clear();
+    m_row.approved_at = 0;
+    m_row.votes = 0;
+    m_row.monthly_votes = 0;
+    m_pending = true;
+  }
+
+  inline table_row& back() noexcept {
+    return m_row;
   }
+
+  inline void done() {
+    flush();
+  }
+};
+
+bot_table internal_parser::parse_table(const std::string& body, const char* key) {
+  bot_table output{};
+  table_builder builder{output};
+  reader<table_row, table_builder> handler{builder, key};
+
+  dpp::json::sax_parse(body, &handler);
+  builder.done();
+
+  return output;
 }
 
-static std::string querystring(const std::string& value) {
-  static constexpr char hex[] = "0123456789abcdef";
-  std::string output{};
+time_t internal_parser::parse_timestamp(const std::string_view value) noexcept {
+  int64_t seconds{};
+  uint32_t nanoseconds{};
+
+  return parse_iso8601(value, seconds, nanoseconds) ? static_cast<time_t>(seconds) : 0;
+}
+
+std::optional<std::chrono::system_clock::time_point> internal_parser::parse_time_point(const std::string_view value) noexcept {
+  int64_t seconds{};
+  uint32_t nanoseconds{};
+
+  if (!parse_iso8601(value, seconds, nanoseconds)) {
+    return std::nullopt;
+  }
+
+  return std::optional{std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds{seconds} + std::chrono::nanoseconds{nanoseconds})}};
+}
+
+template<typename T>
+void internal_parser::deserialize(const dpp::json& j, T& output) {
+  read_fields(j, output, fields<T>::value);
+  finish(output);
+}
+
+template<typename T>
+dpp::json internal_parser::serialize(const T& input) {
+  auto j = dpp::json::object();
+
+  write_fields(j, input, fields<T>::value);
+
+  return j;
+}
+
+template bot internal_parser::parse<bot>(const std::string&);
+template user internal_parser::parse<user>(const std::string&);
+template std::vector<bot> internal_parser::parse_array<bot>(const std::string&, const char*);
+template std::vector<voter> internal_parser::parse_array<voter>(const std::string&, const char*);
+template std::vector<bot> internal_parser::parse_array_parallel<bot>(const std::string&, const char*, size_t);
+template std::vector<voter> internal_parser::parse_array_parallel<voter>(const std::string&, const char*, size_t);
+template void internal_parser::deserialize<account>(const dpp::json&, account&);
+template void internal_parser::deserialize<bot>(const dpp::json&, bot&);
+template void internal_parser::deserialize<user_socials>(const dpp::json&, user_socials&);
+template void internal_parser::deserialize<user>(const dpp::json&, user&);
+template void internal_parser::deserialize<stats>(const dpp::json&, stats&);
+template dpp::json internal_parser::serialize<account>(const account&);
+template dpp::json internal_parser::serialize<bot>(const bot&);
+template dpp::json internal_parser::serialize<user_socials>(const user_socials&);
+template dpp::json internal_parser::serialize<user>(const user&);
+template dpp::json internal_parser::serialize<stats>(const stats&);
+
+batch_bot::batch_bot(const allocator_type& alloc)
+  : avatar(alloc), username(alloc), created_at(0), prefix(alloc), short_description(alloc), long_description(alloc), tags(alloc), website(alloc), github(alloc), owners(alloc), banner(alloc), approved_at(0), votes(0), monthly_votes(0), support(alloc), invite(alloc), url(alloc) {}
+
+batch_bot::batch_bot(batch_bot&& other, const allocator_type& alloc)
+  : id(other.id), avatar(std::move(other.avatar), alloc), username(std::move(other.username), alloc), created_at(other.created_at), prefix(std::move(other.prefix), alloc), short_description(std::move(other.short_description), alloc), long_description(std::move(other.long_description), alloc), tags(std::move(other.tags), alloc), website(std::move(other.website), alloc), github(std::move(other.github), alloc), owners(std::move(other.owners), alloc), banner(std::move(other.banner), alloc), approved_at(other.approved_at), votes(other.votes), monthly_votes(other.monthly_votes), support(std::move(other.support), alloc), invite(std::move(other.invite), alloc), url(std::move(other.url), alloc) {}
+
+bot_batch::bot_batch(const size_t initial_size)
+  : m_arena(std::make_unique<arena>(initial_size)), m_bots(m_arena.get()) {}
+
+bot_batch::bot_batch(bot_batch&& other) noexcept = default;
+
+bot_batch::~bot_batch() = default;
+
+size_t bot_batch::unique_tags() const noexcept {
+  return m_arena->size();
+}
+
+bot_table::bot_table()
+  : m_tag_offsets(1, 0) {}
+
+std::vector<std::string_view> bot_table::tags(const uint32_t row) const {
+  if (row >= size()) {
+    throw std::out_of_range{"The row is out of bounds."};
+  }
+
+  std::vector<std::string_view> output{};
+  const auto begin{m_tag_offsets[row]}, end{m_tag_offsets[row + 1]};
+
+  output.reserve(end - begin);
+
+  for (auto i{begin}; i < end; i++) {
+    output.push_back(m_tag_dictionary[m_tag_codes[i]]);
+  }
+
+  return output;
+}
+
+uint64_t bot_table::total_votes() const noexcept {
+  return std::accumulate(m_votes.begin(), m_votes.end(), uint64_t{});
+}
+
+uint64_t bot_table::total_monthly_votes() const noexcept {
+  return std::accumulate(m_monthly_votes.begin(), m_monthly_votes.end(), uint64_t{});
+}
+
+template<typename C>
+std::vector<uint32_t> bot_table::filter_at_least(const std::vector<C>& column, const C min) const {
+  std::vector<uint32_t> output(column.size());
+  const auto values{column.data()};
+  const auto indexes{output.data()};
+  size_t matches{};
+
+  // branchless so that the compiler can vectorize the comparisons
+  for (size_t i{}; i < column.size(); i++) {
+    indexes[matches] = static_cast<uint32_t>(i);
+    matches += static_cast<size_t>(values[i] >= min);
+  }
+
+  output.resize(matches);
+
+  return output;
+}
 
-  output.reserve(value.length());
+std::vector<uint32_t> bot_table::filter_votes(const size_t min) const {
+  return filter_at_least(m_votes, min);
+}
+
+std::vector<uint32_t> bot_table::filter_monthly_votes(const size_t min) const {
+  return filter_at_least(m_monthly_votes, min);
+}
+
+std::vector<uint32_t> bot_table::filter_approved_between(const time_t from, const time_t to) const {
+  std::vector<uint32_t> output(m_approved_at.size());
+  const auto values{m_approved_at.data()};
+  const auto indexes{output.data()};
+  size_t matches{};
+
+  for (size_t i{}; i < m_approved_at.size(); i++) {
+    indexes[matches] = static_cast<uint32_t>(i);
+    matches += static_cast<size_t>((values[i] >= from) & (values[i] < to));
+  }
+
+  output.resize(matches);
+
+  return output;
+}
+
+std::vector<uint32_t> bot_table::filter_tag(const std::string_view tag) const {
+  std::vector<uint32_t> output{};
+  const auto entry{std::find(m_tag_dictionary.begin(), m_tag_dictionary.end(), tag)};
+
+  if (entry == m_tag_dictionary.end()) {
+    return output;
+  }
+
+  const auto code{static_cast<uint32_t>(entry - m_tag_dictionary.begin())};
+
+  // repeated tags are dropped while the table is built, so every match is a distinct row
+  for (size_t i{}; i < m_tag_codes.size(); i++) {
+    if (m_tag_codes[i] == code) {
+      output.push_back(m_tag_rows[i]);
+    }
+  }
+
+  return output;
+}
+
+std::vector<uint32_t> bot_table::top(const std::vector<size_t>& column, const size_t k) const {
+  std::vector<uint32_t> output(column.size());
+  const auto middle{output.begin() + static_cast<ptrdiff_t>(std::min(k, output.size()))};
+
+  std::iota(output.begin(), output.end(), uint32_t{});
+  std::partial_sort(output.begin(), middle, output.end(), [&column](const uint32_t a, const uint32_t b) {
+    return column[a] > column[b] || (column[a] == column[b] && a < b);
+  });
+
+  output.erase(middle, output.end());
+
+  return output;
+}
+
+std::vector<uint32_t> bot_table::top_votes(const size_t k) const {
+  return top(m_votes, k);
+}
+
+std::vector<uint32_t> bot_table::top_monthly_votes(const size_t k) const {
+  return top(m_monthly_votes, k);
+}
+
+account::account(const dpp::json& j) {
+  internal_parser::deserialize(j, *this);
+}
+
+bot::bot(const dpp::json& j) {
+  internal_parser::deserialize(j, *this);
+}
 
-  for (size_t i{}; i < value.length(); i++) {
-    const auto c{value[i]};
+static void querystring(const std::string_view value, std::string& output) {
+  static constexpr char hex[] = "0123456789abcdef";
+
+  output.reserve(output.size() + value.length() * 3);
 
+  for (const auto c: value) {
     if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9')) {
       output.push_back(c);
     } else {
@@ -185,8 +1496,6 @@ static std::string querystring(const std::string& value) {
       output.push_back(hex[c & 0x0f]);
     }
   }
-
-  return output;
 }
 
 void bot_query::add_query(const char* key, const uint16_t value, const uint16_t max) {
@@ -198,43 +1507,247 @@ void bot_query::add_query(const char* key, const char* value) {
 }
 
 void bot_query::add_search(const char* key, const std::string& value) {
-  ADD_SEARCH(key, querystring(value));
+  m_search.append(key);
+  m_search.append("%3A%20");
+  querystring(value, m_search);
+  m_search.append("%20");
 }
 
 void bot_query::add_search(const char* key, const size_t value) {
   ADD_SEARCH(key, std::to_string(value));
 }
 
-void bot_query::finish(const topgg::get_bots_completion_t& callback) {
+std::string bot_query::finish_query() const {
+  std::string query{m_query};
+
+  query.reserve(query.size() + 32 + m_search.size());
+
   if (m_sort != nullptr) {
-    add_query("sort", m_sort);
+    query.append("sort=").append(m_sort).push_back('&');
   }
 
   if (!m_search.empty()) {
-    add_query("search", m_search.c_str());
+    query.append("search=").append(m_search).push_back('&');
   }
 
-  m_query.pop_back();
+  query.pop_back();
+
+  return query;
+}
+
+static constexpr const char* search_field_names[]{"username", "prefix", "votes", "monthly_votes", "vanity"};
+
+compiled_bot_query bot_query::compile(std::initializer_list<topgg::bot_search_field> slots) const {
+  const auto parameters{m_query.find('?') + 1};
+  std::string base{m_query, 0, parameters};
 
-  m_client->basic_request<std::vector<topgg::bot>>(m_query, callback, [](const auto& j) {
-    std::vector<topgg::bot> bots{};
+  base.reserve(m_query.size() + 16);
 
-    for (const auto& part: j["results"].template get<std::vector<dpp::json>>()) {
-      bots.push_back(topgg::bot{part});
+  // the skip value is supplied on every send, so a skip set before compiling would be sent twice
+  for (auto start{parameters}; start < m_query.size();) {
+    const auto end{m_query.find('&', start)};
+    const auto parameter{std::string_view{m_query}.substr(start, end == std::string::npos ? std::string::npos : end - start + 1)};
+
+    if (parameter.rfind("skip=", 0) != 0) {
+      base.append(parameter);
     }
 
-    return bots;
+    start += parameter.size();
+  }
+
+  if (m_sort != nullptr) {
+    base.append("sort=").append(m_sort).push_back('&');
+  }
+
+  return compiled_bot_query{m_client, std::move(base), std::string{m_search}, std::vector<topgg::bot_search_field>{slots}};
+}
+
+std::string compiled_bot_query::path(const uint16_t skip, std::initializer_list<std::string_view> values) const {
+  if (values.size() != m_slots.size()) {
+    throw std::invalid_argument{"Expected " + std::to_string(m_slots.size()) + " search values."};
+  }
+
+  std::string output{};
+  size_t values_size{};
+
+  for (const auto value: values) {
+    values_size += value.size() * 3 + 24;
+  }
+
+  output.reserve(m_base.size() + 16 + m_search.size() + values_size);
+  output.append(m_base);
+
+  if (skip != 0) {
+    char buffer[8]{};
+    const auto end{std::to_chars(buffer, buffer + sizeof(buffer), std::min<uint16_t>(skip, 499)).ptr};
+
+    output.append("skip=").append(buffer, end).push_back('&');
+  }
+
+  if (!m_search.empty() || values.size() != 0) {
+    output.append("search=").append(m_search);
+
+    auto slot{m_slots.begin()};
+
+    for (const auto value: values) {
+      output.append(search_field_names[static_cast<size_t>(*slot++)]).append("%3A%20");
+      querystring(value, output);
+      output.append("%20");
+    }
+
+    output.push_back('&');
+  }
+
+  output.pop_back();
+
+  return output;
+}
+
+void compiled_bot_query::finish(topgg::get_bots_completion_t callback, const uint16_t skip, std::initializer_list<std::string_view> values) const {
+  m_client->basic_request<std::vector<topgg::bot>>(path(skip, values), std::move(callback), [](auto& body) {
+    return internal_parser::parse_array<topgg::bot>(body, "results");
   });
 }
 
 #ifdef DPP_CORO
-dpp::async<std::vector<topgg::bot>> bot_query::co_finish() {
-  return dpp::async<std::vector<topgg::bot>>{ [this] <typename C> (C&& cc) { return finish(std::forward<C>(cc)); }};
+topgg::async_result<std::vector<topgg::bot>> compiled_bot_query::co_finish(const uint16_t skip, std::initializer_list<std::string_view> values) const {
+  return topgg::async_result<std::vector<topgg::bot>>{ [client = m_client, query = path(skip, values)] <typename C> (C&& cc) {
+    client->basic_request<std::vector<topgg::bot>>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_array<topgg::bot>(body, "results");
+    });
+  }};
+}
+
+topgg::lazy_result<std::vector<topgg::bot>> compiled_bot_query::co_finish_lazy(const uint16_t skip, std::initializer_list<std::string_view> values) const {
+  return topgg::lazy_result<std::vector<topgg::bot>>{ [client = m_client, query = path(skip, values)] <typename C> (C&& cc) {
+    client->basic_request<std::vector<topgg::bot>>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_array<topgg::bot>(body, "results");
+    });
+  }};
+}
+#endif
+
+void bot_query::finish(topgg::get_bots_completion_t callback) {
+  if (m_parallel) {
+    m_client->basic_request<std::vector<topgg::bot>>(finish_query(), std::move(callback), [](auto& body) {
+      return internal_parser::parse_array_parallel<topgg::bot>(body, "results");
+    });
+  } else {
+    m_client->basic_request<std::vector<topgg::bot>>(finish_query(), std::move(callback), [](auto& body) {
+      return internal_parser::parse_array<topgg::bot>(body, "results");
+    });
+  }
+}
+
+#ifdef DPP_CORO
+topgg::async_result<std::vector<topgg::bot>> bot_query::co_finish() {
+  // the query is built right away, so that this bot_query doesn't need to outlive the result
+  if (m_parallel) {
+    return topgg::async_result<std::vector<topgg::bot>>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+      client->basic_request<std::vector<topgg::bot>>(query, std::forward<C>(cc), [](auto& body) {
+        return internal_parser::parse_array_parallel<topgg::bot>(body, "results");
+      });
+    }};
+  }
+
+  return topgg::async_result<std::vector<topgg::bot>>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<std::vector<topgg::bot>>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_array<topgg::bot>(body, "results");
+    });
+  }};
+}
+
+topgg::lazy_result<std::vector<topgg::bot>> bot_query::co_finish_lazy() {
+  if (m_parallel) {
+    return topgg::lazy_result<std::vector<topgg::bot>>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+      client->basic_request<std::vector<topgg::bot>>(query, std::forward<C>(cc), [](auto& body) {
+        return internal_parser::parse_array_parallel<topgg::bot>(body, "results");
+      });
+    }};
+  }
+
+  return topgg::lazy_result<std::vector<topgg::bot>>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<std::vector<topgg::bot>>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_array<topgg::bot>(body, "results");
+    });
+  }};
+}
+#endif
+
+void bot_query::finish_batch(topgg::get_bots_batch_completion_t callback) {
+  m_client->basic_request<topgg::bot_batch>(finish_query(), std::move(callback), [](auto& body) {
+    return internal_parser::parse_batch(body, "results");
+  });
+}
+
+#ifdef DPP_CORO
+topgg::async_result<topgg::bot_batch> bot_query::co_finish_batch() {
+  return topgg::async_result<topgg::bot_batch>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<topgg::bot_batch>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_batch(body, "results");
+    });
+  }};
+}
+
+topgg::lazy_result<topgg::bot_batch> bot_query::co_finish_batch_lazy() {
+  return topgg::lazy_result<topgg::bot_batch>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<topgg::bot_batch>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_batch(body, "results");
+    });
+  }};
+}
+#endif
+
+void bot_query::finish_views(topgg::get_bot_views_completion_t callback) {
+  m_client->basic_request<std::vector<topgg::bot_view>>(finish_query(), std::move(callback), [](auto& body) {
+    return internal_parser::parse_views(body, "results");
+  });
+}
+
+#ifdef DPP_CORO
+topgg::async_result<std::vector<topgg::bot_view>> bot_query::co_finish_views() {
+  return topgg::async_result<std::vector<topgg::bot_view>>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<std::vector<topgg::bot_view>>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_views(body, "results");
+    });
+  }};
+}
+
+topgg::lazy_result<std::vector<topgg::bot_view>> bot_query::co_finish_views_lazy() {
+  return topgg::lazy_result<std::vector<topgg::bot_view>>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<std::vector<topgg::bot_view>>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_views(body, "results");
+    });
+  }};
+}
+#endif
+
+void bot_query::finish_table(topgg::get_bots_table_completion_t callback) {
+  m_client->basic_request<topgg::bot_table>(finish_query(), std::move(callback), [](auto& body) {
+    return internal_parser::parse_table(body, "results");
+  });
+}
+
+#ifdef DPP_CORO
+topgg::async_result<topgg::bot_table> bot_query::co_finish_table() {
+  return topgg::async_result<topgg::bot_table>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<topgg::bot_table>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_table(body, "results");
+    });
+  }};
+}
+
+topgg::lazy_result<topgg::bot_table> bot_query::co_finish_table_lazy() {
+  return topgg::lazy_result<topgg::bot_table>{ [client = m_client, query = finish_query()] <typename C> (C&& cc) {
+    client->basic_request<topgg::bot_table>(query, std::forward<C>(cc), [](auto& body) {
+      return internal_parser::parse_table(body, "results");
+    });
+  }};
 }
 #endif
 
 stats::stats(const dpp::json& j) {
-  DESERIALIZE_PRIVATE_OPTIONAL(j, server_count, size_t);
+  internal_parser::deserialize(j, *this);
 }
 
 stats::stats(dpp::cluster& bot) {
@@ -247,16 +1760,20 @@ stats::stats(dpp::cluster& bot) {
   m_server_count = std::optional{servers};
 }
 
+stats::stats(const guild_counter& counter)
+  : m_server_count(std::optional{counter.total()}) {}
+
+#ifndef _WIN32
+stats::stats(topgg::stats_aggregator& aggregator)
+  : m_server_count(aggregator.total()) {}
+#endif
+
 // TODO: remove this soon
 stats::stats(const std::vector<size_t>& shards, const TOPGG_UNUSED size_t shard_index)
   : m_server_count(std::optional{std::reduce(shards.begin(), shards.end())}) {}
 
 std::string stats::to_json() const {
-  dpp::json j{};
-
-  SERIALIZE_PRIVATE_OPTIONAL(j, server_count);
-
-  return j.dump();
+  return internal_parser::serialize(*this).dump();
 }
 
 std::vector<size_t> stats::shards() const noexcept {
@@ -272,27 +1789,11 @@ std::optional<size_t> stats::server_count() const noexcept {
 }
 
 user_socials::user_socials(const dpp::json& j) {
-  DESERIALIZE_OPTIONAL_STRING(j, github);
-  DESERIALIZE_OPTIONAL_STRING(j, instagram);
-  DESERIALIZE_OPTIONAL_STRING(j, reddit);
-  DESERIALIZE_OPTIONAL_STRING(j, twitter);
-  DESERIALIZE_OPTIONAL_STRING(j, youtube);
+  internal_parser::deserialize(j, *this);
 }
 
+// bit-fields can't have default member initializers before C++20
 user::user(const dpp::json& j)
-  : account(j) {
-  DESERIALIZE_OPTIONAL_STRING(j, bio);
-  DESERIALIZE_OPTIONAL_STRING(j, banner);
-
-  if (j.contains("socials")) {
-    socials = std::optional{user_socials{j["socials"].template get<dpp::json>()}};
-  }
-
-  // TODO: remove this soon
-  is_certified_dev = false;
-
-  DESERIALIZE_ALIAS(j, supporter, is_supporter, bool);
-  DESERIALIZE_ALIAS(j, mod, is_moderator, bool);
-  DESERIALIZE_ALIAS(j, webMod, is_web_moderator, bool);
-  DESERIALIZE_ALIAS(j, admin, is_admin, bool);
-}
+  : is_supporter(false), is_moderator(false), is_web_moderator(false), is_admin(false) {
+  internal_parser::deserialize(j, *this);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <topgg/topgg.h>
+
+using topgg::client;
+using topgg::multi_client;
+
+#include <algorithm>
+
+multi_client::multi_client(dpp::cluster& cluster): m_cluster(cluster), m_timer(0), m_next_task_id(1) {
+  /**
+   * Every client's timer ticks at most every 15 seconds, so a single timer ticking every second serves all of them without noticeable drift.
+   */
+  m_timer = m_cluster.start_timer(m_liveness.guard([this](TOPGG_UNUSED dpp::timer) {
+    tick();
+  }), 1);
+}
+
+dpp::timer multi_client::schedule(std::function<void()> callback, const time_t interval) {
+  std::lock_guard lock{m_mutex};
+  const auto id{m_next_task_id++};
+
+  m_tasks.push_back(task{id, interval, time(nullptr) + interval, std::move(callback)});
+
+  return id;
+}
+
+void multi_client::unschedule(const dpp::timer id) noexcept {
+  std::lock_guard lock{m_mutex};
+
+  /**
+   * Only clear the callback, since this may be called from a running task. tick() removes the task afterwards.
+   */
+  for (auto& t: m_tasks) {
+    if (t.id == id) {
+      t.callback = nullptr;
+    }
+  }
+}
+
+void multi_client::tick() {
+  std::lock_guard lock{m_mutex};
+  const auto now{time(nullptr)};
+
+  for (size_t i{}; i < m_tasks.size(); i++) {
+    if (!m_tasks[i].callback || now < m_tasks[i].next_run) {
+      continue;
+    }
+
+    m_tasks[i].next_run = now + m_tasks[i].interval;
+
+    const auto callback{m_tasks[i].callback};
+
+    callback();
+  }
+
+  m_tasks.erase(std::remove_if(m_tasks.begin(), m_tasks.end(), [](const auto& t) {
+    return !t.callback;
+  }), m_tasks.end());
+}
+
+client& multi_client::add(const dpp::snowflake bot_id, const std::string& token) {
+  std::lock_guard lock{m_mutex};
+
+  if (m_clients.count(bot_id) != 0) {
+    throw std::invalid_argument{"A client for this bot already exists."};
+  }
+
+  std::unique_ptr<client> c{new client{*this, m_cluster, token}};
+  auto& ref{*c};
+
+  m_clients.emplace(bot_id, std::move(c));
+
+  return ref;
+}
+
+client* multi_client::find(const dpp::snowflake bot_id) {
+  std::lock_guard lock{m_mutex};
+  const auto it{m_clients.find(bot_id)};
+
+  return it == m_clients.end() ? nullptr : it->second.get();
+}
+
+bool multi_client::remove(const dpp::snowflake bot_id) {
+  std::lock_guard lock{m_mutex};
+
+  return m_clients.erase(bot_id) > 0;
+}
+
+size_t multi_client::size() {
+  std::lock_guard lock{m_mutex};
+
+  return m_clients.size();
+}
+
+multi_client::~multi_client() {
+  // a tick may already be running on D++'s timer thread
+  m_liveness.end();
+  m_cluster.stop_timer(m_timer);
+
+  std::lock_guard lock{m_mutex};
+
+  m_clients.clear();
+}
@@ -0,0 +1,206 @@
+#include <topgg/topgg.h>
+
+using topgg::reminder_handle;
+using topgg::reminder_scheduler;
+
+#include <algorithm>
+#include <limits>
+
+static constexpr uint32_t REMINDER_NONE = std::numeric_limits<uint32_t>::max();
+static constexpr int REMINDER_SLOT_BITS = 8;
+static constexpr int64_t REMINDER_MAX_DELTA = (int64_t{1} << (REMINDER_SLOT_BITS * 4)) - 1;
+
+reminder_scheduler::reminder_scheduler(dpp::cluster& cluster, const topgg::reminders_due_callback_t& callback)
+  : m_cluster(cluster), m_callback(callback), m_free(REMINDER_NONE), m_size(0), m_now(time(nullptr)), m_timer(0) {
+  for (auto& wheel: m_wheels) {
+    wheel.fill(REMINDER_NONE);
+  }
+
+  m_timer = m_cluster.start_timer(m_liveness.guard([this](TOPGG_UNUSED dpp::timer) {
+    tick();
+  }), 1);
+}
+
+/**
+ * Level n holds the reminders that are due in less than 256^(n + 1) seconds, in the slot picked by the n-th byte of their deadline.
+ * Reminders only move down a level when the slot they're in comes up, so every reminder moves at most three times.
+ */
+void reminder_scheduler::insert(const uint32_t index, const time_t earliest) noexcept {
+  auto& n{m_nodes[index]};
+  const auto effective{std::clamp<int64_t>(n.deadline, earliest, static_cast<int64_t>(m_now) + REMINDER_MAX_DELTA)};
+  const auto delta{effective - static_cast<int64_t>(m_now)};
+  size_t level{};
+
+  while (level + 1 < LEVELS && delta >= (int64_t{1} << (REMINDER_SLOT_BITS * (level + 1)))) {
+    level++;
+  }
+
+  const auto slot{static_cast<size_t>((effective >> (REMINDER_SLOT_BITS * level)) & (SLOTS - 1))};
+  auto& head{m_wheels[level][slot]};
+
+  n.level = static_cast<uint8_t>(level);
+  n.slot = static_cast<uint16_t>(slot);
+  n.previous = REMINDER_NONE;
+  n.next = head;
+
+  if (head != REMINDER_NONE) {
+    m_nodes[head].previous = index;
+  }
+
+  head = index;
+}
+
+void reminder_scheduler::unlink(const uint32_t index) noexcept {
+  const auto& n{m_nodes[index]};
+
+  if (n.previous != REMINDER_NONE) {
+    m_nodes[n.previous].next = n.next;
+  } else {
+    m_wheels[n.level][n.slot] = n.next;
+  }
+
+  if (n.next != REMINDER_NONE) {
+    m_nodes[n.next].previous = n.previous;
+  }
+}
+
+void reminder_scheduler::release(const uint32_t index) noexcept {
+  auto& n{m_nodes[index]};
+
+  n.pending = false;
+  n.generation++;
+  n.next = m_free;
+  m_free = index;
+  m_size--;
+}
+
+void reminder_scheduler::cascade(const size_t level, const size_t slot) noexcept {
+  auto index{m_wheels[level][slot]};
+
+  m_wheels[level][slot] = REMINDER_NONE;
+
+  while (index != REMINDER_NONE) {
+    const auto next{m_nodes[index].next};
+
+    insert(index, m_now);
+    index = next;
+  }
+}
+
+void reminder_scheduler::advance(const time_t now, std::vector<dpp::snowflake>& due) {
+  /**
+   * An empty wheel has nothing to cascade, so it can skip ahead instead of stepping through every second, e.g. after the process was suspended.
+   */
+  if (m_size == 0) {
+    m_now = std::max(m_now, now);
+    return;
+  }
+
+  while (m_now < now) {
+    m_now++;
+
+    /**
+     * Higher levels are cascaded first, so that their reminders can fall all the way down to the slot that's about to fire.
+     */
+    for (size_t level{LEVELS - 1}; level > 0; level--) {
+      bool aligned{true};
+
+      for (size_t lower{}; lower < level; lower++) {
+        aligned = aligned && ((m_now >> (REMINDER_SLOT_BITS * lower)) & (SLOTS - 1)) == 0;
+      }
+
+      if (aligned) {
+        cascade(level, static_cast<size_t>((m_now >> (REMINDER_SLOT_BITS * level)) & (SLOTS - 1)));
+      }
+    }
+
+    const auto slot{static_cast<size_t>(m_now & (SLOTS - 1))};
+    auto index{m_wheels[0][slot]};
+
+    m_wheels[0][slot] = REMINDER_NONE;
+
+    while (index != REMINDER_NONE) {
+      const auto next{m_nodes[index].next};
+
+      if (m_nodes[index].deadline <= static_cast<int64_t>(m_now)) {
+        due.push_back(dpp::snowflake{m_nodes[index].user_id});
+        release(index);
+      } else {
+        insert(index, m_now + 1);
+      }
+
+      index = next;
+    }
+
+    if (m_size == 0) {
+      m_now = std::max(m_now, now);
+    }
+  }
+}
+
+void reminder_scheduler::tick() {
+  std::vector<dpp::snowflake> due{};
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    advance(time(nullptr), due);
+  }
+
+  if (!due.empty()) {
+    m_callback(due);
+  }
+}
+
+reminder_handle reminder_scheduler::schedule(const dpp::snowflake user_id, const time_t deadline) {
+  std::lock_guard lock{m_mutex};
+  uint32_t index{};
+
+  if (m_free != REMINDER_NONE) {
+    index = m_free;
+    m_free = m_nodes[index].next;
+  } else {
+    if (m_nodes.size() >= REMINDER_NONE) {
+      throw std::length_error{"Too many pending reminders."};
+    }
+
+    index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back(node{0, 0, REMINDER_NONE, REMINDER_NONE, 1, 0, 0, false});
+  }
+
+  auto& n{m_nodes[index]};
+
+  n.user_id = static_cast<uint64_t>(user_id);
+  n.deadline = static_cast<int64_t>(deadline);
+  n.pending = true;
+  m_size++;
+
+  insert(index, m_now + 1);
+
+  return reminder_handle{index, n.generation};
+}
+
+bool reminder_scheduler::cancel(const topgg::reminder_handle handle) noexcept {
+  std::lock_guard lock{m_mutex};
+
+  if (handle.index >= m_nodes.size() || !m_nodes[handle.index].pending || m_nodes[handle.index].generation != handle.generation) {
+    return false;
+  }
+
+  unlink(handle.index);
+  release(handle.index);
+
+  return true;
+}
+
+size_t reminder_scheduler::size() noexcept {
+  std::lock_guard lock{m_mutex};
+
+  return m_size;
+}
+
+reminder_scheduler::~reminder_scheduler() {
+  // a tick may already be running on D++'s timer thread
+  m_liveness.end();
+  m_cluster.stop_timer(m_timer);
+}
@@ -1,19 +1,18 @@
 #include <topgg/topgg.h>
 
-using dpp::json;
-
+using topgg::error_category;
 using topgg::internal_result;
 using topgg::internal_server_error;
 using topgg::invalid_token;
 using topgg::not_found;
 using topgg::ratelimited;
+using topgg::result_error;
 
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wunused-function"
-#endif
+#include <algorithm>
+#include <charconv>
+#include <limits>
 
-[[maybe_unused]] static const char* get_dpp_error_message(const dpp::http_error& http_error) {
+static const char* get_dpp_error_message(const dpp::http_error& http_error) {
   switch (http_error) {
   case dpp::h_unknown:
     return "Status unknown.";
@@ -56,30 +55,116 @@ using topgg::ratelimited;
   }
 }
 
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
+std::optional<uint16_t> internal_result::find_retry_after(const std::string_view body) noexcept {
+  const auto key{body.find("\"retry_after\"")};
 
-void internal_result::prepare() const {
-  if (m_response.error != dpp::h_success) {
-    throw m_response.error;
-  } else if (m_response.status >= 400) {
-    switch (m_response.status) {
-    case 401:
-      throw invalid_token{};
+  if (key == std::string_view::npos) {
+    return std::nullopt;
+  }
 
-    case 404:
-      throw not_found{};
+  auto position{key + 13};
 
-    case 429: {
-      const auto j{json::parse(m_response.body)};
-      const auto retry_after{j["retry_after"].template get<uint16_t>()};
+  while (position < body.size() && (body[position] == ' ' || body[position] == ':' || body[position] == '\t' || body[position] == '\n' || body[position] == '\r')) {
+    position++;
+  }
 
-      throw ratelimited{retry_after};
+  const auto end{body.data() + body.size()};
+  uint64_t seconds{};
+  auto [next, error]{std::from_chars(body.data() + position, end, seconds)};
+
+  if (error == std::errc::result_out_of_range) {
+    return std::optional{std::numeric_limits<uint16_t>::max()};
+  } else if (error != std::errc{}) {
+    return std::nullopt;
+  }
+
+  // Top.gg may send fractional seconds, which are rounded up so that retrying never comes too early
+  if (next != end && *next == '.') {
+    while (++next != end && *next >= '0' && *next <= '9') {
+      if (*next != '0') {
+        seconds++;
+        break;
+      }
     }
+  }
+
+  return std::optional{static_cast<uint16_t>(std::min<uint64_t>(seconds, std::numeric_limits<uint16_t>::max()))};
+}
+
+void internal_result::classify() noexcept {
+  const auto status{m_failure.status};
+
+  if (m_failure.http_error != dpp::h_success) {
+    m_failure.category = error_category::http_error;
+  } else if (status >= 400) {
+    switch (status) {
+    case 401:
+      m_failure.category = error_category::invalid_token;
+      break;
+
+    case 404:
+      m_failure.category = error_category::not_found;
+      break;
+
+    case 429:
+      m_failure.category = error_category::ratelimited;
+      m_failure.retry_after = find_retry_after(m_body).value_or(0);
+      break;
 
     default:
-      throw internal_server_error{};
+      m_failure.category = error_category::internal_server_error;
     }
+  } else {
+    return;
   }
-}
\ No newline at end of file
+
+  m_failed = true;
+}
+
+void internal_result::prepare() const {
+  if (!m_failed) {
+    return;
+  }
+
+  switch (m_failure.category) {
+  case error_category::http_error:
+    throw m_failure.http_error;
+
+  case error_category::invalid_token:
+    throw invalid_token{};
+
+  case error_category::not_found:
+    throw not_found{};
+
+  case error_category::ratelimited:
+    throw ratelimited{m_failure.retry_after};
+
+  default:
+    throw internal_server_error{};
+  }
+}
+
+const char* result_error::message() const noexcept {
+  switch (category) {
+  case error_category::http_error:
+    return get_dpp_error_message(http_error);
+
+  case error_category::invalid_token:
+    return "Invalid Top.gg API token.";
+
+  case error_category::not_found:
+    return "Such query does not exist.";
+
+  case error_category::ratelimited:
+    return "This client is ratelimited from further requests. Please try again later.";
+
+  case error_category::internal_server_error:
+    return "Received an unexpected error from Top.gg's end.";
+
+  case error_category::parse_error:
+    return "Received a malformed response from Top.gg.";
+
+  default:
+    return "The data has already been moved out of this result.";
+  }
+}
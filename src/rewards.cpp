@@ -0,0 +1,259 @@
+#include <topgg/topgg.h>
+
+using topgg::reward_pipeline;
+
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+
+static constexpr time_t REWARD_PRUNE_INTERVAL = 60;
+
+/**
+ * D++ may hand response headers over in whatever case Discord sent them in.
+ */
+static const std::string* find_header(const std::multimap<std::string, std::string>& headers, const char* name) noexcept {
+  const auto length{std::strlen(name)};
+
+  for (const auto& header: headers) {
+    if (header.first.size() == length && std::equal(header.first.begin(), header.first.end(), name, [](const char a, const char b) { return std::tolower(static_cast<unsigned char>(a)) == b; })) {
+      return &header.second;
+    }
+  }
+
+  return nullptr;
+}
+
+static double read_seconds(const std::string* value, const double fallback) noexcept {
+  if (value == nullptr) {
+    return fallback;
+  }
+
+  char* end{};
+  const auto seconds{std::strtod(value->c_str(), &end)};
+
+  return end == value->c_str() || seconds < 0 ? fallback : seconds;
+}
+
+size_t reward_pipeline::grant_key_hash::operator()(const grant_key& key) const noexcept {
+  auto h{key.guild_id * 0x9e3779b97f4a7c15};
+
+  h ^= key.user_id + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+  h ^= key.role_id + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+
+  return static_cast<size_t>(h);
+}
+
+reward_pipeline::reward_pipeline(dpp::cluster& cluster, const topgg::reward_options& options)
+  : m_cluster(cluster), m_state(std::make_shared<pipeline_state>()), m_timer(0) {
+  if (options.burst == 0 || options.global_rate == 0) {
+    throw std::invalid_argument{"Burst and global rate mustn't be zero."};
+  }
+
+  m_state->options = options;
+  m_state->last_prune = time(nullptr);
+
+  m_timer = m_cluster.start_timer(m_liveness.guard([this](TOPGG_UNUSED dpp::timer) {
+    tick();
+  }), 1);
+}
+
+void reward_pipeline::add_reward(const dpp::snowflake guild_id, const dpp::snowflake role_id) {
+  std::lock_guard lock{m_rewards_mutex};
+
+  const auto range{m_rewards.equal_range(guild_id)};
+
+  if (std::none_of(range.first, range.second, [role_id](const auto& reward) { return reward.second == role_id; })) {
+    m_rewards.emplace(guild_id, role_id);
+  }
+}
+
+bool reward_pipeline::remove_reward(const dpp::snowflake guild_id, const dpp::snowflake role_id) {
+  std::lock_guard lock{m_rewards_mutex};
+
+  const auto range{m_rewards.equal_range(guild_id)};
+
+  for (auto it{range.first}; it != range.second; it++) {
+    if (it->second == role_id) {
+      m_rewards.erase(it);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool reward_pipeline::enqueue(const grant_key& key) {
+  std::lock_guard lock{m_state->mutex};
+
+  const auto recent{m_state->recent.find(key)};
+
+  if (m_state->queued.count(key) != 0 || (recent != m_state->recent.end() && recent->second + m_state->options.dedupe_window > time(nullptr))) {
+    m_state->deduplicated++;
+    return false;
+  }
+
+  m_state->queued.insert(key);
+  m_state->guilds[key.guild_id].grants.push_back(pending_grant{key, 0});
+  m_state->backlog++;
+
+  return true;
+}
+
+size_t reward_pipeline::grant(const dpp::snowflake user_id) {
+  std::vector<grant_key> keys{};
+
+  {
+    std::lock_guard lock{m_rewards_mutex};
+
+    keys.reserve(m_rewards.size());
+
+    for (const auto& reward: m_rewards) {
+      keys.push_back(grant_key{reward.first, user_id, reward.second});
+    }
+  }
+
+  size_t queued{};
+
+  for (const auto& key: keys) {
+    queued += enqueue(key);
+  }
+
+  return queued;
+}
+
+bool reward_pipeline::grant(const dpp::snowflake guild_id, const dpp::snowflake user_id, const dpp::snowflake role_id) {
+  return enqueue(grant_key{guild_id, user_id, role_id});
+}
+
+void reward_pipeline::complete(const std::shared_ptr<pipeline_state>& state, const pending_grant& grant, const dpp::confirmation_callback_t& event) {
+  const auto& response{event.http_info};
+  const auto now{clock::now()};
+
+  std::lock_guard lock{state->mutex};
+
+  auto& queue{state->guilds[grant.key.guild_id]};
+
+  queue.in_flight--;
+  state->in_flight--;
+
+  /**
+   * Discord reports what's left of the server's ratelimit bucket with every response.
+   */
+  const auto remaining{find_header(response.headers, "x-ratelimit-remaining")};
+
+  if (remaining != nullptr) {
+    queue.remaining = static_cast<size_t>(std::strtoull(remaining->c_str(), nullptr, 10));
+    queue.reset_at = now + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>{read_seconds(find_header(response.headers, "x-ratelimit-reset-after"), 1.0)});
+  }
+
+  if (response.status == 429) {
+    const auto retry_after{read_seconds(find_header(response.headers, "retry-after"), 1.0)};
+
+    queue.remaining = 0;
+    queue.paused_until = now + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>{retry_after});
+    queue.grants.push_front(grant);
+    state->backlog++;
+    state->retried++;
+  } else if (!event.is_error()) {
+    state->queued.erase(grant.key);
+    state->recent[grant.key] = time(nullptr);
+    state->granted++;
+  } else if ((response.error != dpp::h_success || response.status >= 500) && grant.attempts < state->options.max_attempts) {
+    queue.grants.push_back(grant);
+    state->backlog++;
+    state->retried++;
+  } else {
+    state->queued.erase(grant.key);
+    state->failed++;
+  }
+}
+
+void reward_pipeline::tick() {
+  std::vector<pending_grant> batch{};
+  const auto now{clock::now()};
+  const auto seconds{time(nullptr)};
+
+  {
+    std::lock_guard lock{m_state->mutex};
+
+    auto& state{*m_state};
+    const auto budget{state.options.global_rate};
+
+    /**
+     * Round-robin across servers, resuming after the last server served, so that one server's backlog can't starve the others.
+     */
+    auto it{state.guilds.upper_bound(state.cursor)};
+
+    for (size_t visited{}; visited < state.guilds.size() && batch.size() < budget; visited++) {
+      if (it == state.guilds.end()) {
+        it = state.guilds.begin();
+      }
+
+      auto& queue{it->second};
+
+      if (now >= queue.reset_at) {
+        queue.remaining = state.options.burst;
+      }
+
+      if (now >= queue.paused_until) {
+        while (!queue.grants.empty() && queue.in_flight < queue.remaining && batch.size() < budget) {
+          auto grant{queue.grants.front()};
+
+          queue.grants.pop_front();
+          grant.attempts++;
+          queue.in_flight++;
+          state.in_flight++;
+          state.backlog--;
+
+          batch.push_back(grant);
+        }
+      }
+
+      state.cursor = it->first;
+
+      if (queue.grants.empty() && queue.in_flight == 0 && now >= queue.reset_at) {
+        it = state.guilds.erase(it);
+      } else {
+        it++;
+      }
+    }
+
+    const auto granted{state.granted - state.last_granted};
+
+    state.last_granted = state.granted;
+    state.grants_per_second += (static_cast<double>(granted) - state.grants_per_second) * 0.1;
+
+    if (seconds - state.last_prune >= REWARD_PRUNE_INTERVAL) {
+      for (auto recent{state.recent.begin()}; recent != state.recent.end();) {
+        if (recent->second + state.options.dedupe_window <= seconds) {
+          recent = state.recent.erase(recent);
+        } else {
+          recent++;
+        }
+      }
+
+      state.last_prune = seconds;
+    }
+  }
+
+  for (const auto& grant: batch) {
+    m_cluster.guild_member_add_role(grant.key.guild_id, grant.key.user_id, grant.key.role_id, [state = m_state, grant](const auto& event) {
+      complete(state, grant, event);
+    });
+  }
+}
+
+topgg::reward_metrics reward_pipeline::get_metrics() {
+  std::lock_guard lock{m_state->mutex};
+
+  const auto guilds{static_cast<size_t>(std::count_if(m_state->guilds.begin(), m_state->guilds.end(), [](const auto& guild) { return !guild.second.grants.empty(); }))};
+
+  return reward_metrics{m_state->granted, m_state->deduplicated, m_state->failed, m_state->retried, m_state->backlog, m_state->in_flight, guilds, m_state->grants_per_second};
+}
+
+reward_pipeline::~reward_pipeline() {
+  // a tick may already be running on D++'s timer thread
+  m_liveness.end();
+  m_cluster.stop_timer(m_timer);
+}
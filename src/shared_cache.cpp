@@ -0,0 +1,252 @@
+#include <topgg/topgg.h>
+
+#ifndef _WIN32
+
+using topgg::shared_cache;
+
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <cerrno>
+
+static constexpr uint64_t SHARED_CACHE_MAGIC = 0x3245484341434754;
+static constexpr size_t SHARED_CACHE_SLOT_SIZE = 2048;
+static constexpr size_t SHARED_CACHE_PROBES = 8;
+static constexpr int SHARED_CACHE_READ_ATTEMPTS = 4;
+
+struct shared_cache_header {
+  std::atomic<uint64_t> magic;
+  uint64_t capacity;
+  unsigned char padding[48];
+};
+
+/**
+ * The lock word holds the entry's sequence number in its lower half, and the process ID of its last writer in its upper half.
+ * An odd sequence number means the entry is being written. Readers retry when the lock word changed while they were copying.
+ */
+struct shared_cache_slot {
+  std::atomic<uint64_t> lock;
+  std::atomic<uint64_t> bot_id;
+  std::atomic<uint64_t> key;
+  std::atomic<int64_t> expires_at;
+  std::atomic<uint32_t> endpoint;
+  std::atomic<uint32_t> length;
+  unsigned char payload[SHARED_CACHE_SLOT_SIZE - 40];
+};
+
+static_assert(sizeof(shared_cache_header) == 64);
+static_assert(sizeof(shared_cache_slot) == SHARED_CACHE_SLOT_SIZE);
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free, "The shared cache needs lock-free atomics to be shared across processes.");
+
+static inline uint64_t shared_cache_hash(const uint64_t bot_id, const uint64_t id, const uint32_t endpoint) noexcept {
+  auto h{id ^ (static_cast<uint64_t>(endpoint) * 0x9e3779b97f4a7c15)};
+
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccd;
+  h ^= bot_id;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccd;
+  h ^= h >> 33;
+
+  return h;
+}
+
+/**
+ * A process that died between claiming an entry and releasing it would otherwise leave it locked for good.
+ */
+static inline bool shared_cache_abandoned(const uint64_t lock) noexcept {
+  const auto writer{static_cast<pid_t>(lock >> 32)};
+
+  return writer > 0 && kill(writer, 0) != 0 && errno == ESRCH;
+}
+
+shared_cache::shared_cache(const std::string& name, const topgg::shared_cache_options& options)
+  : m_options(options), m_mapping(nullptr), m_mapping_size(0), m_capacity(0) {
+  if (options.capacity == 0) {
+    throw std::invalid_argument{"Capacity mustn't be zero."};
+  }
+
+  size_t capacity{1};
+
+  while (capacity < options.capacity) {
+    capacity *= 2;
+  }
+
+  auto created{true};
+  auto fd{shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600)};
+
+  if (fd < 0 && errno == EEXIST) {
+    created = false;
+    fd = shm_open(name.c_str(), O_RDWR, 0600);
+  }
+
+  if (fd < 0) {
+    throw std::runtime_error{"Failed to open the shared cache."};
+  }
+
+  size_t size{};
+
+  if (created) {
+    size = sizeof(shared_cache_header) + capacity * sizeof(shared_cache_slot);
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+      close(fd);
+      shm_unlink(name.c_str());
+      throw std::runtime_error{"Failed to open the shared cache."};
+    }
+  } else {
+    /**
+     * The creating process may not have sized the segment yet.
+     */
+    for (int attempt{}; attempt < 100; attempt++) {
+      struct stat info{};
+
+      if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(shared_cache_header)) {
+        size = static_cast<size_t>(info.st_size);
+        break;
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+
+  const auto mapping{size == 0 ? MAP_FAILED : mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+
+  close(fd);
+
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error{"Failed to open the shared cache."};
+  }
+
+  m_mapping = static_cast<unsigned char*>(mapping);
+  m_mapping_size = size;
+
+  auto header{reinterpret_cast<shared_cache_header*>(m_mapping)};
+
+  if (created) {
+    header->capacity = capacity;
+    header->magic.store(SHARED_CACHE_MAGIC, std::memory_order_release);
+  } else {
+    for (int attempt{}; attempt < 100 && header->magic.load(std::memory_order_acquire) != SHARED_CACHE_MAGIC; attempt++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    capacity = header->capacity;
+
+    if (header->magic.load(std::memory_order_acquire) != SHARED_CACHE_MAGIC || capacity == 0 || (capacity & (capacity - 1)) != 0 || sizeof(shared_cache_header) + capacity * sizeof(shared_cache_slot) > size) {
+      munmap(m_mapping, m_mapping_size);
+      throw std::runtime_error{"The shared memory segment is not a valid cache."};
+    }
+  }
+
+  m_capacity = capacity;
+}
+
+bool shared_cache::find(const dpp::snowflake bot_id, const uint32_t endpoint, const dpp::snowflake id, std::string& out) const {
+  const auto slots{reinterpret_cast<shared_cache_slot*>(m_mapping + sizeof(shared_cache_header))};
+  const auto mask{m_capacity - 1};
+  const auto start{shared_cache_hash(bot_id, id, endpoint)};
+  const auto now{static_cast<int64_t>(time(nullptr))};
+
+  for (size_t probe{}; probe < SHARED_CACHE_PROBES; probe++) {
+    auto& slot{slots[(start + probe) & mask]};
+
+    for (int attempt{}; attempt < SHARED_CACHE_READ_ATTEMPTS; attempt++) {
+      const auto before{slot.lock.load(std::memory_order_acquire)};
+
+      if ((before & 1) != 0) {
+        continue;
+      }
+
+      if (slot.key.load(std::memory_order_relaxed) != static_cast<uint64_t>(id) || slot.endpoint.load(std::memory_order_relaxed) != endpoint || slot.bot_id.load(std::memory_order_relaxed) != static_cast<uint64_t>(bot_id)) {
+        break;
+      } else if (slot.expires_at.load(std::memory_order_relaxed) <= now) {
+        return false;
+      }
+
+      const auto length{std::min<size_t>(slot.length.load(std::memory_order_relaxed), sizeof(slot.payload))};
+
+      out.assign(reinterpret_cast<const char*>(slot.payload), length);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (slot.lock.load(std::memory_order_relaxed) == before) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+void shared_cache::store(const dpp::snowflake bot_id, const uint32_t endpoint, const dpp::snowflake id, const std::string& body) noexcept {
+  const auto ttl{endpoint == vote_endpoint ? m_options.vote_ttl : m_options.user_ttl};
+
+  if (body.size() > sizeof(shared_cache_slot::payload) || ttl <= 0) {
+    return;
+  }
+
+  const auto slots{reinterpret_cast<shared_cache_slot*>(m_mapping + sizeof(shared_cache_header))};
+  const auto mask{m_capacity - 1};
+  const auto start{shared_cache_hash(bot_id, id, endpoint)};
+  const auto now{static_cast<int64_t>(time(nullptr))};
+  shared_cache_slot* target{};
+
+  /**
+   * Prefers the entry that already holds this key, then an expired one, then the one closest to expiring.
+   */
+  for (size_t probe{}; probe < SHARED_CACHE_PROBES; probe++) {
+    auto& slot{slots[(start + probe) & mask]};
+
+    if (slot.key.load(std::memory_order_relaxed) == static_cast<uint64_t>(id) && slot.endpoint.load(std::memory_order_relaxed) == endpoint && slot.bot_id.load(std::memory_order_relaxed) == static_cast<uint64_t>(bot_id)) {
+      target = &slot;
+      break;
+    } else if (target == nullptr || (target->expires_at.load(std::memory_order_relaxed) > now && slot.expires_at.load(std::memory_order_relaxed) < target->expires_at.load(std::memory_order_relaxed))) {
+      target = &slot;
+    }
+  }
+
+  auto lock{target->lock.load(std::memory_order_relaxed)};
+
+  /**
+   * Another process is writing this entry. Skip caching rather than wait for it, unless that process died mid-write.
+   * Taking over an abandoned entry moves its sequence number two ahead, so that it stays odd while it's rewritten.
+   */
+  if ((lock & 1) != 0 && !shared_cache_abandoned(lock)) {
+    return;
+  }
+
+  const auto writer{static_cast<uint64_t>(getpid()) << 32};
+  const auto sequence{static_cast<uint32_t>(lock) + ((lock & 1) != 0 ? 2 : 1)};
+
+  if (!target->lock.compare_exchange_strong(lock, writer | sequence, std::memory_order_acquire, std::memory_order_relaxed)) {
+    return;
+  }
+
+  std::atomic_thread_fence(std::memory_order_release);
+
+  target->bot_id.store(static_cast<uint64_t>(bot_id), std::memory_order_relaxed);
+  target->key.store(static_cast<uint64_t>(id), std::memory_order_relaxed);
+  target->endpoint.store(endpoint, std::memory_order_relaxed);
+  target->expires_at.store(now + static_cast<int64_t>(ttl), std::memory_order_relaxed);
+  target->length.store(static_cast<uint32_t>(body.size()), std::memory_order_relaxed);
+  std::memcpy(target->payload, body.data(), body.size());
+
+  target->lock.store(writer | static_cast<uint32_t>(sequence + 1), std::memory_order_release);
+}
+
+bool shared_cache::unlink(const std::string& name) noexcept {
+  return shm_unlink(name.c_str()) == 0;
+}
+
+shared_cache::~shared_cache() {
+  munmap(m_mapping, m_mapping_size);
+}
+
+#endif
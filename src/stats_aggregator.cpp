@@ -0,0 +1,230 @@
+#include <topgg/topgg.h>
+
+#ifndef _WIN32
+
+using topgg::stats_aggregator;
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cstring>
+#include <cerrno>
+
+/**
+ * The datagram every process sends to the poster. Every process in a group runs the same build on the same host, so it's sent as-is.
+ */
+struct aggregator_message {
+  uint32_t magic;
+  uint32_t process_id;
+  uint64_t count;
+};
+
+static constexpr uint32_t AGGREGATOR_MAGIC = 0x54474741;
+
+static int open_socket() noexcept {
+  const auto fd{socket(AF_UNIX, SOCK_DGRAM, 0)};
+
+  if (fd < 0) {
+    return -1;
+  }
+
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+  return fd;
+}
+
+static sockaddr_un socket_address(const std::string& path) noexcept {
+  sockaddr_un address{};
+
+  address.sun_family = AF_UNIX;
+  std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+  return address;
+}
+
+static uint64_t path_inode(const std::string& path) noexcept {
+  struct stat info{};
+
+  return stat(path.c_str(), &info) == 0 ? static_cast<uint64_t>(info.st_ino) : 0;
+}
+
+stats_aggregator::stats_aggregator(dpp::cluster& cluster, const std::string& path, const uint32_t process_id, const topgg::partial_count_callback_t& callback, const time_t interval)
+  : m_cluster(cluster), m_path(path), m_callback(callback), m_interval(interval), m_process_id(process_id), m_timer(0), m_leader_since(0), m_next_report(0), m_path_inode(0), m_socket(-1), m_leader(false) {
+  if (path.empty() || path.size() >= sizeof(sockaddr_un::sun_path)) {
+    throw std::invalid_argument{"Socket path is too long."};
+  } else if (interval <= 0) {
+    throw std::invalid_argument{"Interval must be positive."};
+  }
+
+  if (!m_callback) {
+    m_callback = [](dpp::cluster& bot) {
+      size_t servers{};
+
+      for (auto& s: bot.get_shards()) {
+        servers += s.second->get_guild_count();
+      }
+
+      return servers;
+    };
+  }
+
+  m_socket = open_socket();
+
+  if (m_socket < 0) {
+    throw std::runtime_error{"Failed to create the aggregator socket."};
+  }
+
+  try_lead();
+
+  /**
+   * Linux only queues a handful of datagrams per socket, so the timer ticks every second to let the poster drain its queue and let reporters retry sends that would've blocked.
+   * Reports themselves are still only sent once per interval.
+   */
+  m_timer = m_cluster.start_timer(m_liveness.guard([this](TOPGG_UNUSED dpp::timer) {
+    tick();
+  }), 1);
+
+  tick();
+}
+
+/**
+ * Binding the shared path is the election. A path that's left behind by a crashed poster is only removed once a send to it has been refused.
+ */
+bool stats_aggregator::try_lead() {
+  const auto address{socket_address(m_path)};
+
+  if (bind(m_socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+    return false;
+  }
+
+  m_leader = true;
+  m_leader_since = time(nullptr);
+  m_path_inode = path_inode(m_path);
+  m_reports.clear();
+
+  return true;
+}
+
+void stats_aggregator::step_down() noexcept {
+  const auto fd{open_socket()};
+
+  if (fd >= 0) {
+    close(m_socket);
+    m_socket = fd;
+  }
+
+  m_leader = false;
+  m_reports.clear();
+}
+
+void stats_aggregator::tick() {
+  std::lock_guard lock{m_mutex};
+  const auto now{time(nullptr)};
+  const auto report_due{now >= m_next_report};
+  size_t count{};
+
+  if (report_due) {
+    count = m_callback(m_cluster);
+  }
+
+  if (m_leader) {
+    /**
+     * Another process may have removed our path and bound its own socket to it. Our socket is then unreachable, so let that process lead.
+     */
+    if (path_inode(m_path) != m_path_inode) {
+      step_down();
+    } else {
+      aggregator_message message{};
+
+      while (recv(m_socket, &message, sizeof(message), 0) == static_cast<ssize_t>(sizeof(message))) {
+        if (message.magic == AGGREGATOR_MAGIC && message.process_id != m_process_id) {
+          m_reports[message.process_id] = report{static_cast<size_t>(message.count), now};
+        }
+      }
+
+      if (!report_due) {
+        return;
+      }
+
+      m_reports[m_process_id] = report{count, now};
+      m_next_report = now + m_interval;
+
+      for (auto it{m_reports.begin()}; it != m_reports.end();) {
+        if (now - it->second.last_seen > m_interval * 3) {
+          it = m_reports.erase(it);
+        } else {
+          it++;
+        }
+      }
+
+      return;
+    }
+  }
+
+  if (!report_due) {
+    return;
+  }
+
+  const aggregator_message message{AGGREGATOR_MAGIC, m_process_id, static_cast<uint64_t>(count)};
+  const auto address{socket_address(m_path)};
+
+  if (sendto(m_socket, &message, sizeof(message), 0, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) >= 0) {
+    m_next_report = now + m_interval;
+    return;
+  }
+
+  if (errno == ECONNREFUSED) {
+    unlink(m_path.c_str());
+  } else if (errno != ENOENT) {
+    return;
+  }
+
+  if (try_lead()) {
+    m_reports[m_process_id] = report{count, now};
+    m_next_report = now + m_interval;
+  }
+}
+
+bool stats_aggregator::is_leader() noexcept {
+  std::lock_guard lock{m_mutex};
+
+  return m_leader;
+}
+
+std::optional<size_t> stats_aggregator::total() {
+  std::lock_guard lock{m_mutex};
+
+  /**
+   * A new poster has to wait for a full round of reports first, otherwise it would post a partial total.
+   */
+  if (!m_leader || time(nullptr) - m_leader_since < m_interval * 2) {
+    return std::nullopt;
+  }
+
+  size_t servers{};
+
+  for (const auto& r: m_reports) {
+    servers += r.second.count;
+  }
+
+  return std::optional{servers};
+}
+
+stats_aggregator::~stats_aggregator() {
+  // a tick may already be running on D++'s timer thread
+  m_liveness.end();
+  m_cluster.stop_timer(m_timer);
+
+  std::lock_guard lock{m_mutex};
+
+  if (m_leader && path_inode(m_path) == m_path_inode) {
+    unlink(m_path.c_str());
+  }
+
+  close(m_socket);
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include <topgg/topgg.h>
+
+#ifdef DPP_CORO
+
+using topgg::internal_frame_pool;
+
+#include <array>
+#include <new>
+
+static constexpr size_t FRAME_GRANULARITY = 64;
+static constexpr size_t FRAME_CLASSES = 64;
+static constexpr size_t FRAME_CACHE_LIMIT = 64;
+
+struct frame_node {
+  frame_node* next;
+};
+
+/**
+ * Each size class keeps at most FRAME_CACHE_LIMIT frames, so that a thread that only ever frees frames allocated elsewhere can't hoard memory.
+ */
+struct frame_cache {
+  std::array<frame_node*, FRAME_CLASSES> heads{};
+  std::array<size_t, FRAME_CLASSES> sizes{};
+
+  ~frame_cache();
+};
+
+static thread_local bool frame_cache_gone{};
+
+frame_cache::~frame_cache() {
+  for (auto head: heads) {
+    while (head != nullptr) {
+      const auto next{head->next};
+
+      ::operator delete(head);
+      head = next;
+    }
+  }
+
+  frame_cache_gone = true;
+}
+
+static frame_cache* get_frame_cache() noexcept {
+  // frames may still be freed while this thread's cache is being destroyed
+  if (frame_cache_gone) {
+    return nullptr;
+  }
+
+  static thread_local frame_cache cache{};
+
+  return &cache;
+}
+
+void* internal_frame_pool::allocate(const size_t size) {
+  const auto size_class{(size + FRAME_GRANULARITY - 1) / FRAME_GRANULARITY};
+
+  if (size_class == 0 || size_class > FRAME_CLASSES) {
+    return ::operator new(size);
+  }
+
+  const auto cache{get_frame_cache()};
+
+  if (cache != nullptr) {
+    auto& head{cache->heads[size_class - 1]};
+
+    if (head != nullptr) {
+      const auto frame{head};
+
+      head = frame->next;
+      cache->sizes[size_class - 1]--;
+
+      return frame;
+    }
+  }
+
+  return ::operator new(size_class * FRAME_GRANULARITY);
+}
+
+void internal_frame_pool::deallocate(void* frame, const size_t size) noexcept {
+  const auto size_class{(size + FRAME_GRANULARITY - 1) / FRAME_GRANULARITY};
+
+  if (size_class == 0 || size_class > FRAME_CLASSES) {
+    ::operator delete(frame);
+    return;
+  }
+
+  const auto cache{get_frame_cache()};
+
+  if (cache == nullptr || cache->sizes[size_class - 1] >= FRAME_CACHE_LIMIT) {
+    ::operator delete(frame);
+    return;
+  }
+
+  auto& head{cache->heads[size_class - 1]};
+
+  head = new (frame) frame_node{head};
+  cache->sizes[size_class - 1]++;
+}
+
+#endif
@@ -0,0 +1,610 @@
+#include <topgg/topgg.h>
+
+using topgg::account_view;
+using topgg::bot_view;
+using topgg::internal_parser;
+using topgg::user_view;
+using topgg::view_span;
+
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+static std::string_view format_snowflake(char (&buffer)[24], const dpp::snowflake id) noexcept {
+  return std::string_view{buffer, static_cast<size_t>(std::to_chars(buffer, buffer + sizeof(buffer), static_cast<uint64_t>(id)).ptr - buffer)};
+}
+
+/**
+ * A minimal JSON scanner that records where each wanted string value lives in the response body instead of copying it.
+ * Escape sequences are decoded in place, which never makes a string longer, so every value stays a contiguous slice of the body.
+ */
+class topgg::view_scanner {
+  std::string& m_body;
+  size_t m_position;
+
+  [[noreturn]] static void fail() {
+    throw std::runtime_error{"Malformed JSON response."};
+  }
+
+  inline char peek() {
+    while (m_position < m_body.size() && (m_body[m_position] == ' ' || m_body[m_position] == '\n' || m_body[m_position] == '\r' || m_body[m_position] == '\t')) {
+      m_position++;
+    }
+
+    if (m_position >= m_body.size()) {
+      fail();
+    }
+
+    return m_body[m_position];
+  }
+
+  inline void expect(const char c) {
+    if (peek() != c) {
+      fail();
+    }
+
+    m_position++;
+  }
+
+  void literal(const char* text) {
+    const auto length{strlen(text)};
+
+    if (m_body.compare(m_position, length, text) != 0) {
+      fail();
+    }
+
+    m_position += length;
+  }
+
+  uint32_t hex4() {
+    uint32_t output{};
+
+    if (m_position + 4 > m_body.size()) {
+      fail();
+    }
+
+    for (const auto end{m_position + 4}; m_position < end; m_position++) {
+      const auto c{m_body[m_position]};
+
+      output <<= 4;
+
+      if ('0' <= c && c <= '9') {
+        output |= static_cast<uint32_t>(c - '0');
+      } else if ('a' <= c && c <= 'f') {
+        output |= static_cast<uint32_t>(c - 'a' + 10);
+      } else if ('A' <= c && c <= 'F') {
+        output |= static_cast<uint32_t>(c - 'A' + 10);
+      } else {
+        fail();
+      }
+    }
+
+    return output;
+  }
+
+  size_t unescape(size_t write) {
+    const auto escaped{m_body[m_position++]};
+
+    switch (escaped) {
+      case '"':
+      case '\\':
+      case '/':
+        m_body[write++] = escaped;
+        break;
+
+      case 'b':
+        m_body[write++] = '\b';
+        break;
+
+      case 'f':
+        m_body[write++] = '\f';
+        break;
+
+      case 'n':
+        m_body[write++] = '\n';
+        break;
+
+      case 'r':
+        m_body[write++] = '\r';
+        break;
+
+      case 't':
+        m_body[write++] = '\t';
+        break;
+
+      case 'u': {
+        auto codepoint{hex4()};
+
+        if (0xd800 <= codepoint && codepoint <= 0xdbff && m_body.compare(m_position, 2, "\\u") == 0) {
+          m_position += 2;
+
+          const auto low{hex4()};
+
+          if (low < 0xdc00 || low > 0xdfff) {
+            fail();
+          }
+
+          codepoint = 0x10000 + ((codepoint - 0xd800) << 10) + (low - 0xdc00);
+        }
+
+        if (codepoint < 0x80) {
+          m_body[write++] = static_cast<char>(codepoint);
+        } else if (codepoint < 0x800) {
+          m_body[write++] = static_cast<char>(0xc0 | (codepoint >> 6));
+          m_body[write++] = static_cast<char>(0x80 | (codepoint & 0x3f));
+        } else if (codepoint < 0x10000) {
+          m_body[write++] = static_cast<char>(0xe0 | (codepoint >> 12));
+          m_body[write++] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+          m_body[write++] = static_cast<char>(0x80 | (codepoint & 0x3f));
+        } else {
+          m_body[write++] = static_cast<char>(0xf0 | (codepoint >> 18));
+          m_body[write++] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f));
+          m_body[write++] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+          m_body[write++] = static_cast<char>(0x80 | (codepoint & 0x3f));
+        }
+
+        break;
+      }
+
+      default:
+        fail();
+    }
+
+    return write;
+  }
+
+  view_span string() {
+    expect('"');
+
+    const auto start{m_position};
+
+    // most strings have no escape sequences, so they are left untouched
+    while (m_position < m_body.size() && m_body[m_position] != '"' && m_body[m_position] != '\\') {
+      m_position++;
+    }
+
+    auto write{m_position};
+
+    while (true) {
+      if (m_position >= m_body.size()) {
+        fail();
+      }
+
+      const auto c{m_body[m_position++]};
+
+      if (c == '"') {
+        break;
+      } else if (c == '\\') {
+        if (m_position >= m_body.size()) {
+          fail();
+        }
+
+        write = unescape(write);
+      } else {
+        m_body[write++] = c;
+      }
+    }
+
+    return view_span{static_cast<uint32_t>(start), static_cast<uint32_t>(write - start)};
+  }
+
+  inline std::string_view key() {
+    const auto span{string()};
+
+    expect(':');
+
+    return std::string_view{m_body.data() + span.offset, span.length};
+  }
+
+  template<typename F>
+  void object(F&& on_member) {
+    expect('{');
+
+    if (peek() == '}') {
+      m_position++;
+      return;
+    }
+
+    while (true) {
+      on_member(key());
+
+      if (peek() == '}') {
+        m_position++;
+        return;
+      }
+
+      expect(',');
+    }
+  }
+
+  template<typename F>
+  void array(F&& on_item) {
+    expect('[');
+
+    if (peek() == ']') {
+      m_position++;
+      return;
+    }
+
+    while (true) {
+      on_item();
+
+      if (peek() == ']') {
+        m_position++;
+        return;
+      }
+
+      expect(',');
+    }
+  }
+
+  void skip() {
+    switch (peek()) {
+      case '"':
+        string();
+        break;
+
+      case '{':
+        object([this](TOPGG_UNUSED const std::string_view key) { skip(); });
+        break;
+
+      case '[':
+        array([this]() { skip(); });
+        break;
+
+      case 't':
+        literal("true");
+        break;
+
+      case 'f':
+        literal("false");
+        break;
+
+      case 'n':
+        literal("null");
+        break;
+
+      default:
+        number();
+    }
+  }
+
+  size_t number() {
+    const auto negative{peek() == '-'};
+
+    if (negative) {
+      m_position++;
+    }
+
+    const auto start{m_position};
+    size_t output{};
+
+    while (m_position < m_body.size() && '0' <= m_body[m_position] && m_body[m_position] <= '9') {
+      output = output * 10 + static_cast<size_t>(m_body[m_position++] - '0');
+    }
+
+    if (m_position == start) {
+      fail();
+    }
+
+    // fractions and exponents never appear in these models' integers, but they still need to be consumed
+    while (m_position < m_body.size() && (m_body[m_position] == '.' || m_body[m_position] == 'e' || m_body[m_position] == 'E' || m_body[m_position] == '+' || m_body[m_position] == '-' || ('0' <= m_body[m_position] && m_body[m_position] <= '9'))) {
+      m_position++;
+    }
+
+    return negative ? 0 : output;
+  }
+
+  view_span optional_string() {
+    if (peek() == '"') {
+      return string();
+    }
+
+    skip();
+
+    return view_span{};
+  }
+
+  size_t optional_number() {
+    const auto c{peek()};
+
+    if (c == '-' || ('0' <= c && c <= '9')) {
+      return number();
+    }
+
+    skip();
+
+    return 0;
+  }
+
+  bool optional_boolean() {
+    const auto c{peek()};
+
+    if (c == 't' || c == 'f') {
+      literal(c == 't' ? "true" : "false");
+
+      return c == 't';
+    }
+
+    skip();
+
+    return false;
+  }
+
+  bool read_member(account_view& output, const std::string_view key) {
+    if (key == "id") {
+      const auto span{optional_string()};
+      uint64_t id{};
+
+      std::from_chars(m_body.data() + span.offset, m_body.data() + span.offset + span.length, id);
+      output.m_id = dpp::snowflake{id};
+    } else if (key == "username") {
+      output.m_username = optional_string();
+    } else if (key == "avatar") {
+      output.m_avatar = optional_string();
+    } else {
+      return false;
+    }
+
+    return true;
+  }
+
+  void read_member(bot_view& output, const std::string_view key) {
+    if (read_member(static_cast<account_view&>(output), key)) {
+      return;
+    } else if (key == "prefix") {
+      output.m_prefix = optional_string();
+    } else if (key == "shortdesc") {
+      output.m_short_description = optional_string();
+    } else if (key == "longdesc") {
+      output.m_long_description = optional_string();
+    } else if (key == "tags" && peek() == '[') {
+      array([this, &output]() {
+        const auto span{optional_string()};
+
+        if (span.length != 0) {
+          output.m_tags.push_back(span);
+        }
+      });
+    } else if (key == "website") {
+      output.m_website = optional_string();
+    } else if (key == "github") {
+      output.m_github = optional_string();
+    } else if (key == "owners" && peek() == '[') {
+      // owner IDs are only parsed when they are accessed
+      const auto start{m_position};
+
+      skip();
+      output.m_owners = view_span{static_cast<uint32_t>(start), static_cast<uint32_t>(m_position - start)};
+    } else if (key == "bannerUrl") {
+      output.m_banner = optional_string();
+    } else if (key == "date") {
+      output.m_approved_at = optional_string();
+    } else if (key == "points") {
+      output.m_votes = optional_number();
+    } else if (key == "monthlyPoints") {
+      output.m_monthly_votes = optional_number();
+    } else if (key == "support") {
+      output.m_support = optional_string();
+    } else if (key == "invite") {
+      output.m_invite = optional_string();
+    } else if (key == "vanity") {
+      output.m_vanity = optional_string();
+    } else {
+      skip();
+    }
+  }
+
+  void read_member(user_view& output, const std::string_view key) {
+    if (read_member(static_cast<account_view&>(output), key)) {
+      return;
+    } else if (key == "bio") {
+      output.m_bio = optional_string();
+    } else if (key == "banner") {
+      output.m_banner = optional_string();
+    } else if (key == "socials" && peek() == '{') {
+      object([this, &output](const std::string_view social) {
+        if (social == "github") {
+          output.m_github = optional_string();
+        } else if (social == "instagram") {
+          output.m_instagram = optional_string();
+        } else if (social == "reddit") {
+          output.m_reddit = optional_string();
+        } else if (social == "twitter") {
+          output.m_twitter = optional_string();
+        } else if (social == "youtube") {
+          output.m_youtube = optional_string();
+        } else {
+          skip();
+        }
+      });
+    } else if (key == "supporter") {
+      output.m_is_supporter = optional_boolean();
+    } else if (key == "mod") {
+      output.m_is_moderator = optional_boolean();
+    } else if (key == "webMod") {
+      output.m_is_web_moderator = optional_boolean();
+    } else if (key == "admin") {
+      output.m_is_admin = optional_boolean();
+    } else {
+      skip();
+    }
+  }
+
+public:
+  inline view_scanner(std::string& body)
+    : m_body(body), m_position(0) {
+    if (body.size() > std::numeric_limits<uint32_t>::max()) {
+      fail();
+    }
+  }
+
+  template<typename T>
+  T read(const std::shared_ptr<const std::string>& body) {
+    T output{};
+
+    object([this, &output](const std::string_view key) {
+      read_member(output, key);
+    });
+
+    if (output.m_id == 0) {
+      throw std::runtime_error{"Missing account ID."};
+    }
+
+    output.m_body = body;
+
+    return output;
+  }
+
+  template<typename T>
+  std::vector<T> read_array(const std::shared_ptr<const std::string>& body, const char* container_key) {
+    std::vector<T> output{};
+
+    const auto read_elements{[this, &body, &output]() {
+      array([this, &body, &output]() {
+        if (peek() == '{') {
+          output.push_back(read<T>(body));
+        } else {
+          skip();
+        }
+      });
+    }};
+
+    if (container_key == nullptr) {
+      read_elements();
+    } else {
+      object([this, container_key, &read_elements](const std::string_view key) {
+        if (key == container_key && peek() == '[') {
+          read_elements();
+        } else {
+          skip();
+        }
+      });
+    }
+
+    return output;
+  }
+};
+
+template<typename T>
+T internal_parser::parse_view(std::string& body) {
+  // the body is taken over instead of copied, then shared by every view that points into it
+  auto shared{std::make_shared<std::string>(std::move(body))};
+
+  return view_scanner{*shared}.read<T>(shared);
+}
+
+std::vector<bot_view> internal_parser::parse_views(std::string& body, const char* key) {
+  auto shared{std::make_shared<std::string>(std::move(body))};
+
+  return view_scanner{*shared}.read_array<bot_view>(shared, key);
+}
+
+template bot_view internal_parser::parse_view<bot_view>(std::string&);
+template user_view internal_parser::parse_view<user_view>(std::string&);
+
+account_view::account_view() noexcept
+  : m_id(0), m_username(), m_avatar() {}
+
+std::string account_view::avatar() const {
+  std::string output{};
+
+  if (m_avatar.length == 0) {
+    output.reserve(46);
+    output.append("https://cdn.discordapp.com/embed/avatars/");
+    output.push_back(static_cast<char>('0' + ((m_id >> 22) % 6)));
+    output.append(".png");
+  } else {
+    // this is only the avatar hash
+    const auto hash{at(m_avatar)};
+    char id_buffer[24]{};
+
+    output.reserve(64 + hash.size());
+    output.append("https://cdn.discordapp.com/avatars/").append(format_snowflake(id_buffer, m_id)).push_back('/');
+    output.append(hash).append(hash.rfind("a_", 0) == 0 ? ".gif" : ".png").append("?size=1024");
+  }
+
+  return output;
+}
+
+bot_view::bot_view() noexcept
+  : m_prefix(), m_short_description(), m_long_description(), m_website(), m_github(), m_owners(), m_banner(), m_approved_at(), m_support(), m_invite(), m_vanity(), m_votes(0), m_monthly_votes(0) {}
+
+std::vector<std::string_view> bot_view::tags() const {
+  std::vector<std::string_view> output{};
+
+  output.reserve(m_tags.size());
+
+  for (const auto span: m_tags) {
+    output.push_back(at(span));
+  }
+
+  return output;
+}
+
+std::vector<dpp::snowflake> bot_view::owners() const {
+  std::vector<dpp::snowflake> output{};
+  const auto raw{at(m_owners)};
+
+  for (size_t i{raw.find('"')}; i != std::string_view::npos; i = raw.find('"', i + 1)) {
+    uint64_t id{};
+    const auto parsed{std::from_chars(raw.data() + i + 1, raw.data() + raw.size(), id)};
+
+    if (parsed.ec == std::errc{}) {
+      output.push_back(dpp::snowflake{id});
+    }
+
+    // skip past this string's closing quote
+    i = raw.find('"', static_cast<size_t>(parsed.ptr - raw.data()));
+
+    if (i == std::string_view::npos) {
+      break;
+    }
+  }
+
+  return output;
+}
+
+time_t bot_view::approved_at() const {
+  return m_approved_at.length == 0 ? 0 : internal_parser::parse_timestamp(at(m_approved_at));
+}
+
+std::string bot_view::support() const {
+  std::string output{};
+
+  if (m_support.length != 0) {
+    const auto code{at(m_support)};
+
+    output.reserve(27 + code.size());
+    output.append("https://discord.com/invite/").append(code);
+  }
+
+  return output;
+}
+
+std::string bot_view::invite() const {
+  if (m_invite.length != 0) {
+    return std::string{at(m_invite)};
+  }
+
+  char id_buffer[24]{};
+
+  return std::string{"https://discord.com/oauth2/authorize?scope=bot&client_id="}.append(format_snowflake(id_buffer, m_id));
+}
+
+std::string bot_view::url() const {
+  std::string output{"https://top.gg/bot/"};
+
+  if (m_vanity.length != 0) {
+    output.append(at(m_vanity));
+  } else {
+    char id_buffer[24]{};
+
+    output.append(format_snowflake(id_buffer, m_id));
+  }
+
+  return output;
+}
+
+user_view::user_view() noexcept
+  : m_bio(), m_banner(), m_github(), m_instagram(), m_reddit(), m_twitter(), m_youtube(), m_is_supporter(false), m_is_moderator(false), m_is_web_moderator(false), m_is_admin(false) {}
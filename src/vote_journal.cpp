@@ -0,0 +1,441 @@
+#include <topgg/topgg.h>
+
+#ifndef _WIN32
+
+using topgg::journal_record;
+using topgg::vote_journal;
+
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <charconv>
+#include <atomic>
+#include <cstring>
+#include <cerrno>
+#include <array>
+
+static constexpr uint32_t JOURNAL_MAGIC = 0x4a564754;
+static constexpr uint32_t JOURNAL_RECORD_MARKER = 0x52564754;
+static constexpr uint16_t JOURNAL_VERSION = 1;
+static constexpr size_t JOURNAL_HEADER_SIZE = 64;
+static constexpr time_t JOURNAL_UNKNOWN_NEWEST = -1;
+
+struct journal_header {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+  uint64_t capacity;
+  uint64_t sequence;
+};
+
+/**
+ * The marker is written last, so that a record is only considered written once it's complete. The checksum catches records torn by a crash or power loss.
+ */
+struct journal_entry {
+  uint64_t voter_id;
+  int64_t timestamp;
+  uint32_t checksum;
+  uint32_t marker;
+};
+
+static_assert(sizeof(journal_header) <= JOURNAL_HEADER_SIZE);
+static_assert(sizeof(journal_entry) == 24);
+
+static constexpr std::array<uint32_t, 256> make_crc32_table() noexcept {
+  std::array<uint32_t, 256> table{};
+
+  for (uint32_t i{}; i < 256; i++) {
+    uint32_t c{i};
+
+    for (int k{}; k < 8; k++) {
+      c = (c & 1) != 0 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+    }
+
+    table[i] = c;
+  }
+
+  return table;
+}
+
+static constexpr auto CRC32_TABLE = make_crc32_table();
+
+static uint32_t crc32(const unsigned char* data, const size_t length) noexcept {
+  uint32_t crc{0xffffffff};
+
+  for (size_t i{}; i < length; i++) {
+    crc = CRC32_TABLE[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+
+  return crc ^ 0xffffffff;
+}
+
+/**
+ * The segment's sequence number is part of the checksum, so that records left over from a reused file are never mistaken for new ones.
+ */
+static uint32_t entry_checksum(const uint64_t voter_id, const int64_t timestamp, const uint64_t sequence) noexcept {
+  unsigned char buffer[24];
+
+  std::memcpy(buffer, &voter_id, 8);
+  std::memcpy(buffer + 8, &timestamp, 8);
+  std::memcpy(buffer + 16, &sequence, 8);
+
+  return crc32(buffer, sizeof(buffer));
+}
+
+/**
+ * Calls the callback for every valid record in a mapped segment and returns the amount of valid records, stopping at the first torn or unwritten one.
+ */
+template<typename F>
+static size_t scan_segment(const unsigned char* mapping, const size_t mapping_size, F&& callback) noexcept(noexcept(callback(journal_entry{}))) {
+  if (mapping_size < JOURNAL_HEADER_SIZE) {
+    return 0;
+  }
+
+  journal_header header{};
+
+  std::memcpy(&header, mapping, sizeof(header));
+
+  if (header.magic != JOURNAL_MAGIC || header.version != JOURNAL_VERSION || header.record_size != sizeof(journal_entry)) {
+    return 0;
+  }
+
+  const auto capacity{std::min<size_t>(header.capacity, (mapping_size - JOURNAL_HEADER_SIZE) / sizeof(journal_entry))};
+  const auto records{reinterpret_cast<const journal_entry*>(mapping + JOURNAL_HEADER_SIZE)};
+  size_t count{};
+
+  for (; count < capacity; count++) {
+    const auto& entry{records[count]};
+
+    if (entry.marker != JOURNAL_RECORD_MARKER || entry.checksum != entry_checksum(entry.voter_id, entry.timestamp, header.sequence)) {
+      break;
+    }
+
+    callback(entry);
+  }
+
+  return count;
+}
+
+vote_journal::vote_journal(const std::string& directory, const topgg::vote_journal_options& options)
+  : m_directory(directory), m_options(options), m_active{0, JOURNAL_UNKNOWN_NEWEST}, m_mapping(nullptr), m_mapping_size(0), m_count(0), m_synced(0), m_last_sync(time(nullptr)), m_fd(-1) {
+  if (options.segment_records == 0) {
+    throw std::invalid_argument{"Segments must hold at least one record."};
+  }
+
+  if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+    throw std::runtime_error{"Failed to open the vote journal."};
+  }
+
+  const auto dir{opendir(directory.c_str())};
+
+  if (dir == nullptr) {
+    throw std::runtime_error{"Failed to open the vote journal."};
+  }
+
+  std::vector<uint64_t> sequences{};
+
+  while (const auto entry{readdir(dir)}) {
+    const std::string_view name{entry->d_name};
+
+    if (name.size() != 24 || name.substr(16) != ".journal") {
+      continue;
+    }
+
+    uint64_t sequence{};
+    const auto [ptr, ec]{std::from_chars(name.data(), name.data() + 16, sequence, 16)};
+
+    if (ec == std::errc{} && ptr == name.data() + 16) {
+      sequences.push_back(sequence);
+    }
+  }
+
+  closedir(dir);
+  std::sort(sequences.begin(), sequences.end());
+
+  if (sequences.empty()) {
+    use_segment(0, open_segment(0, true));
+    return;
+  }
+
+  for (size_t i{}; i + 1 < sequences.size(); i++) {
+    m_sealed.push_back(segment{sequences[i], JOURNAL_UNKNOWN_NEWEST});
+  }
+
+  use_segment(sequences.back(), open_segment(sequences.back(), false));
+}
+
+std::string vote_journal::path(const uint64_t sequence) const {
+  char name[32];
+
+  snprintf(name, sizeof(name), "%016llx.journal", static_cast<unsigned long long>(sequence));
+
+  return m_directory + "/" + name;
+}
+
+/**
+ * Maps a segment without touching the journal's state, so that a failure leaves the active segment as it was.
+ */
+vote_journal::mapped_segment vote_journal::open_segment(const uint64_t sequence, const bool create) const {
+  const auto segment_path{path(sequence)};
+  const auto fd{open(segment_path.c_str(), O_RDWR | O_CLOEXEC | (create ? O_CREAT | O_EXCL : 0), 0644)};
+
+  if (fd < 0) {
+    throw std::runtime_error{"Failed to open a vote journal segment."};
+  }
+
+  // a half-created segment would make every later attempt fail with EEXIST
+  const auto fail{[&segment_path, fd, create]() {
+    close(fd);
+
+    if (create) {
+      unlink(segment_path.c_str());
+    }
+
+    throw std::runtime_error{"Failed to open a vote journal segment."};
+  }};
+
+  struct stat info{};
+
+  fstat(fd, &info);
+
+  auto size{static_cast<size_t>(info.st_size)};
+
+  /**
+   * New segments are sized up front, so that appends never have to grow the file and are just memory writes.
+   */
+  if (create || size < JOURNAL_HEADER_SIZE) {
+    size = JOURNAL_HEADER_SIZE + m_options.segment_records * sizeof(journal_entry);
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+      fail();
+    }
+  }
+
+  const auto mapping{mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+
+  if (mapping == MAP_FAILED) {
+    fail();
+  }
+
+  const auto bytes{static_cast<unsigned char*>(mapping)};
+  journal_header header{};
+
+  std::memcpy(&header, bytes, sizeof(header));
+
+  if (header.magic != JOURNAL_MAGIC) {
+    header = journal_header{JOURNAL_MAGIC, JOURNAL_VERSION, static_cast<uint16_t>(sizeof(journal_entry)), (size - JOURNAL_HEADER_SIZE) / sizeof(journal_entry), sequence};
+
+    std::memcpy(bytes, &header, sizeof(header));
+    msync(bytes, JOURNAL_HEADER_SIZE, MS_SYNC);
+  }
+
+  time_t newest{JOURNAL_UNKNOWN_NEWEST};
+
+  const auto count{scan_segment(bytes, size, [&newest](const journal_entry& entry) noexcept {
+    newest = std::max<time_t>(newest, static_cast<time_t>(entry.timestamp));
+  })};
+
+  /**
+   * Records after a torn one would otherwise become valid again once the torn one is overwritten, so they're wiped before appending.
+   */
+  const auto records{reinterpret_cast<journal_entry*>(bytes + JOURNAL_HEADER_SIZE)};
+  const auto capacity{(size - JOURNAL_HEADER_SIZE) / sizeof(journal_entry)};
+  auto wiped{count};
+
+  while (wiped < capacity && records[wiped].marker != 0) {
+    records[wiped++] = journal_entry{};
+  }
+
+  if (wiped != count) {
+    msync(bytes, size, MS_SYNC);
+  }
+
+  return mapped_segment{bytes, size, count, newest, fd};
+}
+
+void vote_journal::use_segment(const uint64_t sequence, const mapped_segment& opened) noexcept {
+  m_fd = opened.fd;
+  m_mapping = opened.mapping;
+  m_mapping_size = opened.size;
+  m_count = opened.count;
+  m_synced = opened.count;
+  m_active = segment{sequence, opened.newest};
+}
+
+void vote_journal::close_segment() noexcept {
+  if (m_mapping != nullptr) {
+    sync_locked();
+    munmap(m_mapping, m_mapping_size);
+    close(m_fd);
+
+    m_mapping = nullptr;
+    m_fd = -1;
+  }
+}
+
+void vote_journal::sync_locked() noexcept {
+  if (m_synced == m_count) {
+    return;
+  }
+
+  /**
+   * msync needs a page-aligned start, so sync from the page holding the first unsynced record.
+   */
+  const auto page_size{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+  const auto start{JOURNAL_HEADER_SIZE + m_synced * sizeof(journal_entry)};
+  const auto aligned_start{start - (start % page_size)};
+  const auto end{JOURNAL_HEADER_SIZE + m_count * sizeof(journal_entry)};
+
+  msync(m_mapping + aligned_start, end - aligned_start, MS_SYNC);
+
+  m_synced = m_count;
+  m_last_sync = time(nullptr);
+}
+
+void vote_journal::append(const dpp::snowflake voter_id, const time_t timestamp) {
+  std::lock_guard lock{m_mutex};
+
+  journal_header header{};
+
+  std::memcpy(&header, m_mapping, sizeof(header));
+
+  if (m_count >= header.capacity) {
+    const auto next{m_active.sequence + 1};
+
+    /**
+     * The next segment is opened before the full one is sealed. If that throws, the journal keeps the full segment active and tries again on the next append.
+     */
+    const auto opened{open_segment(next, true)};
+
+    close_segment();
+    m_sealed.push_back(m_active);
+    use_segment(next, opened);
+    header.sequence = next;
+  }
+
+  auto& entry{reinterpret_cast<journal_entry*>(m_mapping + JOURNAL_HEADER_SIZE)[m_count]};
+
+  entry.voter_id = static_cast<uint64_t>(voter_id);
+  entry.timestamp = static_cast<int64_t>(timestamp);
+  entry.checksum = entry_checksum(entry.voter_id, entry.timestamp, header.sequence);
+  std::atomic_thread_fence(std::memory_order_release);
+  entry.marker = JOURNAL_RECORD_MARKER;
+
+  m_count++;
+  m_active.newest = std::max(m_active.newest, timestamp);
+
+  if (m_count - m_synced >= m_options.sync_every || time(nullptr) - m_last_sync >= m_options.sync_interval) {
+    sync_locked();
+  }
+}
+
+size_t vote_journal::replay(const topgg::journal_replay_callback_t& callback) {
+  std::lock_guard lock{m_mutex};
+  size_t replayed{};
+
+  const auto replay_entry{[&callback, &replayed](const journal_entry& entry) {
+    callback(journal_record{dpp::snowflake{entry.voter_id}, static_cast<time_t>(entry.timestamp)});
+    replayed++;
+  }};
+
+  for (auto& s: m_sealed) {
+    const auto fd{open(path(s.sequence).c_str(), O_RDONLY | O_CLOEXEC)};
+
+    if (fd < 0) {
+      continue;
+    }
+
+    struct stat info{};
+
+    fstat(fd, &info);
+
+    const auto size{static_cast<size_t>(info.st_size)};
+    const auto mapping{size == 0 ? MAP_FAILED : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+      continue;
+    }
+
+    madvise(mapping, size, MADV_SEQUENTIAL);
+
+    time_t newest{JOURNAL_UNKNOWN_NEWEST};
+
+    scan_segment(static_cast<const unsigned char*>(mapping), size, [&](const journal_entry& entry) {
+      newest = std::max<time_t>(newest, static_cast<time_t>(entry.timestamp));
+      replay_entry(entry);
+    });
+
+    munmap(mapping, size);
+    s.newest = newest;
+  }
+
+  scan_segment(m_mapping, JOURNAL_HEADER_SIZE + m_count * sizeof(journal_entry), replay_entry);
+
+  return replayed;
+}
+
+void vote_journal::sync() noexcept {
+  std::lock_guard lock{m_mutex};
+
+  sync_locked();
+}
+
+size_t vote_journal::compact(const time_t cutoff) {
+  std::lock_guard lock{m_mutex};
+  size_t deleted{};
+
+  for (auto it{m_sealed.begin()}; it != m_sealed.end();) {
+    const auto segment_path{path(it->sequence)};
+
+    /**
+     * Segments that were never replayed since opening the journal don't know their newest record yet.
+     */
+    if (it->newest == JOURNAL_UNKNOWN_NEWEST) {
+      const auto fd{open(segment_path.c_str(), O_RDONLY | O_CLOEXEC)};
+
+      if (fd >= 0) {
+        struct stat info{};
+
+        fstat(fd, &info);
+
+        const auto size{static_cast<size_t>(info.st_size)};
+        const auto mapping{size == 0 ? MAP_FAILED : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+
+        close(fd);
+
+        if (mapping != MAP_FAILED) {
+          time_t newest{JOURNAL_UNKNOWN_NEWEST};
+
+          scan_segment(static_cast<const unsigned char*>(mapping), size, [&newest](const journal_entry& entry) noexcept {
+            newest = std::max<time_t>(newest, static_cast<time_t>(entry.timestamp));
+          });
+
+          munmap(mapping, size);
+          it->newest = newest;
+        }
+      }
+    }
+
+    if (it->newest < cutoff && unlink(segment_path.c_str()) == 0) {
+      it = m_sealed.erase(it);
+      deleted++;
+    } else {
+      it++;
+    }
+  }
+
+  return deleted;
+}
+
+vote_journal::~vote_journal() {
+  std::lock_guard lock{m_mutex};
+
+  close_segment();
+}
+
+#endif
@@ -0,0 +1,901 @@
+#include <topgg/topgg.h>
+
+#ifdef __linux__
+
+using topgg::webhook_server;
+using topgg::webhook_vote;
+using topgg::webhook_worker;
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+
+/**
+ * A worker thread fed by an intrusive multi-producer single-consumer queue (Dmitry Vyukov's), so that acceptors never take a lock to hand over a vote.
+ * The worker only sleeps on its eventfd once its queue is empty, and producers only write to the eventfd when the worker is actually sleeping.
+ */
+class topgg::webhook_worker {
+  struct node {
+    std::atomic<node*> next;
+    const webhook_vote_callback_t* callback;
+    webhook_vote vote;
+  };
+
+  std::atomic<node*> m_head;
+  node* m_tail;
+  std::atomic<bool> m_sleeping;
+  std::atomic<bool> m_stopping;
+  int m_wake_fd;
+  std::thread m_thread;
+
+  void wake() noexcept {
+    const uint64_t value{1};
+
+    TOPGG_UNUSED const auto written{write(m_wake_fd, &value, sizeof(value))};
+  }
+
+  node* pop() noexcept {
+    const auto next{m_tail->next.load()};
+
+    if (next == nullptr) {
+      return nullptr;
+    }
+
+    /**
+     * The popped node becomes the new stub, so only the old stub is freed here.
+     */
+    delete m_tail;
+    m_tail = next;
+
+    return next;
+  }
+
+  void run() {
+    while (true) {
+      const auto n{pop()};
+
+      if (n != nullptr) {
+        try {
+          (*n->callback)(n->vote);
+        } catch (TOPGG_UNUSED const std::exception&) {}
+
+        n->vote.query.clear();
+        continue;
+      }
+
+      if (m_stopping.load()) {
+        return;
+      }
+
+      m_sleeping.store(true);
+
+      if (m_tail->next.load() != nullptr || m_stopping.load()) {
+        m_sleeping.store(false);
+        continue;
+      }
+
+      uint64_t value{};
+
+      TOPGG_UNUSED const auto read_bytes{read(m_wake_fd, &value, sizeof(value))};
+
+      m_sleeping.store(false);
+    }
+  }
+
+public:
+  webhook_worker(): m_head(nullptr), m_tail(nullptr), m_sleeping(false), m_stopping(false), m_wake_fd(eventfd(0, EFD_CLOEXEC)) {
+    if (m_wake_fd < 0) {
+      throw std::runtime_error{"Failed to create the webhook worker."};
+    }
+
+    m_tail = new node{{nullptr}, nullptr, webhook_vote{}};
+    m_head.store(m_tail);
+    m_thread = std::thread{[this]() {
+      run();
+    }};
+  }
+
+  void push(const webhook_vote_callback_t* callback, webhook_vote&& vote) {
+    const auto n{new node{{nullptr}, callback, std::move(vote)}};
+    const auto previous{m_head.exchange(n)};
+
+    previous->next.store(n);
+
+    if (m_sleeping.exchange(false)) {
+      wake();
+    }
+  }
+
+  void stop() noexcept {
+    m_stopping.store(true);
+    wake();
+
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  ~webhook_worker() {
+    stop();
+
+    while (pop() != nullptr) {}
+
+    delete m_tail;
+    close(m_wake_fd);
+  }
+};
+
+/**
+ * Compares the whole expected authorization no matter where the first mismatch is, so that response times don't leak how much of it was guessed right.
+ */
+static bool equals_constant_time(const std::string_view input, const std::string_view expected) noexcept {
+  unsigned char difference{static_cast<unsigned char>(input.size() != expected.size())};
+
+  for (size_t i{}; i < expected.size(); i++) {
+    difference |= static_cast<unsigned char>(expected[i] ^ (i < input.size() ? input[i] : 0));
+  }
+
+  return difference == 0;
+}
+
+/**
+ * Reads the fixed Top.gg vote payload without building a DOM. Unknown keys are skipped.
+ */
+class vote_reader {
+  const char* m_it;
+  const char* m_end;
+
+  void whitespace() noexcept {
+    while (m_it < m_end && (*m_it == ' ' || *m_it == '\t' || *m_it == '\n' || *m_it == '\r')) {
+      m_it++;
+    }
+  }
+
+  bool expect(const char c) noexcept {
+    whitespace();
+
+    if (m_it < m_end && *m_it == c) {
+      m_it++;
+      return true;
+    }
+
+    return false;
+  }
+
+  static void append_utf8(std::string& out, const uint32_t codepoint) {
+    if (codepoint < 0x80) {
+      out.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+      out.push_back(static_cast<char>(0xc0 | (codepoint >> 6)));
+      out.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    } else if (codepoint < 0x10000) {
+      out.push_back(static_cast<char>(0xe0 | (codepoint >> 12)));
+      out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+      out.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    } else {
+      out.push_back(static_cast<char>(0xf0 | (codepoint >> 18)));
+      out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
+      out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+      out.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    }
+  }
+
+  bool hex4(uint32_t& out) noexcept {
+    if (m_end - m_it < 4) {
+      return false;
+    }
+
+    const auto [ptr, ec]{std::from_chars(m_it, m_it + 4, out, 16)};
+
+    if (ec != std::errc{} || ptr != m_it + 4) {
+      return false;
+    }
+
+    m_it += 4;
+    return true;
+  }
+
+  bool string(std::string* out) {
+    if (!expect('"')) {
+      return false;
+    }
+
+    while (m_it < m_end) {
+      const auto c{*m_it++};
+
+      if (c == '"') {
+        return true;
+      } else if (c != '\\') {
+        if (out != nullptr) {
+          out->push_back(c);
+        }
+
+        continue;
+      } else if (m_it == m_end) {
+        return false;
+      }
+
+      const auto escaped{*m_it++};
+      char unescaped{};
+
+      switch (escaped) {
+      case '"':
+      case '\\':
+      case '/':
+        unescaped = escaped;
+        break;
+
+      case 'b':
+        unescaped = '\b';
+        break;
+
+      case 'f':
+        unescaped = '\f';
+        break;
+
+      case 'n':
+        unescaped = '\n';
+        break;
+
+      case 'r':
+        unescaped = '\r';
+        break;
+
+      case 't':
+        unescaped = '\t';
+        break;
+
+      case 'u': {
+        uint32_t codepoint{};
+
+        if (!hex4(codepoint)) {
+          return false;
+        }
+
+        // like nlohmann, surrogates are only accepted as a high and low pair
+        if (codepoint >= 0xd800 && codepoint < 0xdc00) {
+          uint32_t low{};
+
+          if (m_end - m_it < 2 || m_it[0] != '\\' || m_it[1] != 'u') {
+            return false;
+          }
+
+          m_it += 2;
+
+          if (!hex4(low) || low < 0xdc00 || low > 0xdfff) {
+            return false;
+          }
+
+          codepoint = 0x10000 + ((codepoint - 0xd800) << 10) + (low - 0xdc00);
+        } else if (codepoint >= 0xdc00 && codepoint <= 0xdfff) {
+          return false;
+        }
+
+        if (out != nullptr) {
+          append_utf8(*out, codepoint);
+        }
+
+        continue;
+      }
+
+      default:
+        return false;
+      }
+
+      if (out != nullptr) {
+        out->push_back(unescaped);
+      }
+    }
+
+    return false;
+  }
+
+  bool snowflake(dpp::snowflake& out) {
+    whitespace();
+
+    if (m_it == m_end || *m_it != '"') {
+      return false;
+    }
+
+    const auto start{++m_it};
+
+    while (m_it < m_end && *m_it != '"') {
+      m_it++;
+    }
+
+    uint64_t value{};
+    const auto [ptr, ec]{std::from_chars(start, m_it, value)};
+
+    if (m_it == m_end || ec != std::errc{} || ptr != m_it) {
+      return false;
+    }
+
+    m_it++;
+    out = value;
+
+    return true;
+  }
+
+  bool literal(bool& out) noexcept {
+    whitespace();
+
+    if (m_end - m_it >= 4 && std::memcmp(m_it, "true", 4) == 0) {
+      m_it += 4;
+      out = true;
+    } else if (m_end - m_it >= 5 && std::memcmp(m_it, "false", 5) == 0) {
+      m_it += 5;
+      out = false;
+    } else {
+      return false;
+    }
+
+    return true;
+  }
+
+  bool skip() {
+    whitespace();
+
+    if (m_it == m_end) {
+      return false;
+    } else if (*m_it == '"') {
+      return string(nullptr);
+    }
+
+    size_t depth{};
+
+    while (m_it < m_end) {
+      const auto c{*m_it};
+
+      if (c == '"') {
+        if (!string(nullptr)) {
+          return false;
+        }
+
+        continue;
+      } else if (c == '{' || c == '[') {
+        depth++;
+      } else if (c == '}' || c == ']') {
+        if (depth == 0) {
+          return true;
+        }
+
+        depth--;
+      } else if (c == ',' && depth == 0) {
+        return true;
+      }
+
+      m_it++;
+    }
+
+    return depth == 0;
+  }
+
+public:
+  inline vote_reader(const std::string_view body) noexcept
+    : m_it(body.data()), m_end(body.data() + body.size()) {}
+
+  bool read(webhook_vote& vote) {
+    std::string key{};
+
+    if (!expect('{')) {
+      return false;
+    } else if (expect('}')) {
+      return false;
+    }
+
+    do {
+      key.clear();
+
+      if (!string(&key) || !expect(':')) {
+        return false;
+      }
+
+      bool ok{};
+
+      if (key == "bot" || key == "guild") {
+        ok = snowflake(vote.receiver_id);
+      } else if (key == "user") {
+        ok = snowflake(vote.voter_id);
+      } else if (key == "type") {
+        std::string type{};
+
+        ok = string(&type);
+        vote.is_test = type == "test";
+      } else if (key == "isWeekend") {
+        ok = literal(vote.is_weekend);
+      } else if (key == "query") {
+        whitespace();
+
+        if (m_it < m_end && *m_it == '"') {
+          ok = string(&vote.query);
+        } else {
+          ok = skip();
+        }
+      } else {
+        ok = skip();
+      }
+
+      if (!ok) {
+        return false;
+      }
+    } while (expect(','));
+
+    return expect('}') && vote.receiver_id != 0 && vote.voter_id != 0;
+  }
+};
+
+webhook_server::webhook_server(const topgg::webhook_options& options): m_options(options), m_running(false), m_stop_fd(-1) {}
+
+void webhook_server::route(const std::string& path, const std::string& authorization, const topgg::webhook_vote_callback_t& callback) {
+  if (m_running.load()) {
+    throw std::invalid_argument{"Routes can't be added while the webhook server is running."};
+  } else if (!m_routes.emplace(path, route_entry{authorization, callback}).second) {
+    throw std::invalid_argument{"This path is already routed."};
+  }
+}
+
+uint16_t webhook_server::dispatch(const std::string_view path, const std::string_view authorization, const std::string_view body) {
+  const auto route_it{m_routes.find(std::string{path})};
+
+  if (route_it == m_routes.end()) {
+    return 404;
+  } else if (!equals_constant_time(authorization, route_it->second.authorization)) {
+    return 401;
+  }
+
+  webhook_vote vote{0, 0, false, false, {}};
+
+  if (!vote_reader{body}.read(vote)) {
+    return 400;
+  }
+
+  const auto worker_index{static_cast<uint64_t>(vote.voter_id) % m_workers.size()};
+
+  m_workers[worker_index]->push(&route_it->second.callback, std::move(vote));
+
+  return 204;
+}
+
+static const char* status_text(const uint16_t status) noexcept {
+  switch (status) {
+  case 204:
+    return "204 No Content";
+
+  case 400:
+    return "400 Bad Request";
+
+  case 401:
+    return "401 Unauthorized";
+
+  case 404:
+    return "404 Not Found";
+
+  case 405:
+    return "405 Method Not Allowed";
+
+  case 413:
+    return "413 Payload Too Large";
+
+  default:
+    return "501 Not Implemented";
+  }
+}
+
+static bool equals_ignore_case(const std::string_view a, const std::string_view b) noexcept {
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const char x, const char y) {
+    return (x | 0x20) == (y | 0x20);
+  });
+}
+
+static std::string_view trim(std::string_view value) noexcept {
+  while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+    value.remove_prefix(1);
+  }
+
+  while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+    value.remove_suffix(1);
+  }
+
+  return value;
+}
+
+namespace {
+  struct webhook_connection {
+    std::string in;
+    std::string out;
+    time_t last_active;
+    bool closing;
+    bool writing;
+  };
+}
+
+void webhook_server::accept_loop(const int listener) {
+  const auto epoll_fd{epoll_create1(EPOLL_CLOEXEC)};
+
+  if (epoll_fd < 0) {
+    return;
+  }
+
+  epoll_event event{};
+
+  event.events = EPOLLIN;
+  event.data.fd = listener;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listener, &event);
+
+  event.data.fd = m_stop_fd;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, m_stop_fd, &event);
+
+  std::unordered_map<int, webhook_connection> connections{};
+  epoll_event events[64];
+  char buffer[4096];
+  auto last_sweep{time(nullptr)};
+
+  const auto close_connection{[&](const int fd) {
+    close(fd);
+    connections.erase(fd);
+  }};
+
+  /**
+   * Writes as much of the pending output as the socket takes, and only waits for EPOLLOUT when it's full.
+   */
+  const auto flush{[&](const int fd, webhook_connection& c) {
+    while (!c.out.empty()) {
+      const auto sent{send(fd, c.out.data(), c.out.size(), MSG_NOSIGNAL)};
+
+      if (sent < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+          break;
+        }
+
+        return false;
+      }
+
+      c.out.erase(0, static_cast<size_t>(sent));
+    }
+
+    const auto writing{!c.out.empty()};
+
+    if (writing != c.writing) {
+      epoll_event change{};
+
+      change.events = EPOLLIN | EPOLLRDHUP | (writing ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+      change.data.fd = fd;
+      epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &change);
+      c.writing = writing;
+    }
+
+    return writing || !c.closing;
+  }};
+
+  const auto respond{[](webhook_connection& c, const uint16_t status, const bool keep_alive) {
+    c.out.append("HTTP/1.1 ").append(status_text(status)).append("\r\nContent-Length: 0\r\nConnection: ").append(keep_alive ? "keep-alive" : "close").append("\r\n\r\n");
+
+    if (!keep_alive) {
+      c.closing = true;
+    }
+  }};
+
+  /**
+   * Handles every complete request in the input buffer, which also takes care of pipelined requests.
+   */
+  const auto process{[&](webhook_connection& c) {
+    size_t consumed{};
+
+    while (!c.closing) {
+      const std::string_view input{c.in.data() + consumed, c.in.size() - consumed};
+      const auto header_end{input.find("\r\n\r\n")};
+
+      if (header_end == std::string_view::npos) {
+        if (input.size() > m_options.max_request_size) {
+          respond(c, 413, false);
+        }
+
+        break;
+      }
+
+      const auto request_line_end{input.find("\r\n")};
+      const auto request_line{input.substr(0, request_line_end)};
+      const auto method_end{request_line.find(' ')};
+      const auto target_end{request_line.find(' ', method_end + 1)};
+
+      if (method_end == std::string_view::npos || target_end == std::string_view::npos) {
+        respond(c, 400, false);
+        break;
+      }
+
+      const auto method{request_line.substr(0, method_end)};
+      auto path{request_line.substr(method_end + 1, target_end - method_end - 1)};
+      const auto version{request_line.substr(target_end + 1)};
+
+      path = path.substr(0, path.find('?'));
+
+      std::string_view authorization{};
+      size_t content_length{};
+      auto keep_alive{version == "HTTP/1.1"};
+      auto chunked{false};
+      auto malformed{false};
+      auto line_start{request_line_end + 2};
+
+      while (line_start < header_end) {
+        const auto line_end{input.find("\r\n", line_start)};
+        const auto line{input.substr(line_start, line_end - line_start)};
+        const auto colon{line.find(':')};
+
+        line_start = line_end + 2;
+
+        if (colon == std::string_view::npos) {
+          continue;
+        }
+
+        const auto name{trim(line.substr(0, colon))};
+        const auto value{trim(line.substr(colon + 1))};
+
+        if (equals_ignore_case(name, "authorization")) {
+          authorization = value;
+        } else if (equals_ignore_case(name, "content-length")) {
+          const auto [end, error]{std::from_chars(value.data(), value.data() + value.size(), content_length)};
+
+          if (error == std::errc::result_out_of_range) {
+            content_length = std::numeric_limits<size_t>::max();
+          }
+
+          // a length that can't be trusted can't be used to find where the next pipelined request starts either
+          malformed |= value.empty() || (error != std::errc{} && error != std::errc::result_out_of_range) || end != value.data() + value.size();
+        } else if (equals_ignore_case(name, "connection")) {
+          if (equals_ignore_case(value, "close")) {
+            keep_alive = false;
+          } else if (equals_ignore_case(value, "keep-alive")) {
+            keep_alive = true;
+          }
+        } else if (equals_ignore_case(name, "transfer-encoding")) {
+          chunked = true;
+        }
+      }
+
+      if (malformed) {
+        respond(c, 400, false);
+        break;
+      } else if (chunked) {
+        respond(c, 501, false);
+        break;
+      }
+
+      // compared before adding, so that a huge Content-Length can't wrap the request size around
+      if (content_length > m_options.max_request_size || header_end + 4 + content_length > m_options.max_request_size) {
+        respond(c, 413, false);
+        break;
+      }
+
+      const auto request_size{header_end + 4 + content_length};
+
+      if (input.size() < request_size) {
+        break;
+      }
+
+      const auto body{input.substr(header_end + 4, content_length)};
+
+      respond(c, method == "POST" ? dispatch(path, authorization, body) : 405, keep_alive);
+      consumed += request_size;
+    }
+
+    c.in.erase(0, consumed);
+  }};
+
+  while (m_running.load(std::memory_order_relaxed)) {
+    const auto count{epoll_wait(epoll_fd, events, 64, 1000)};
+    const auto now{time(nullptr)};
+
+    for (int i{}; i < count; i++) {
+      const auto fd{events[i].data.fd};
+
+      if (fd == m_stop_fd) {
+        continue;
+      } else if (fd == listener) {
+        while (true) {
+          const auto client_fd{accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)};
+
+          if (client_fd < 0) {
+            break;
+          }
+
+          const int enabled{1};
+
+          setsockopt(client_fd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+
+          epoll_event add{};
+
+          add.events = EPOLLIN | EPOLLRDHUP;
+          add.data.fd = client_fd;
+
+          if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client_fd, &add) != 0) {
+            close(client_fd);
+            continue;
+          }
+
+          connections[client_fd] = webhook_connection{{}, {}, now, false, false};
+        }
+
+        continue;
+      }
+
+      const auto it{connections.find(fd)};
+
+      if (it == connections.end()) {
+        continue;
+      }
+
+      auto& c{it->second};
+      auto open{(events[i].events & EPOLLERR) == 0};
+
+      c.last_active = now;
+
+      if (open && (events[i].events & EPOLLIN) != 0) {
+        while (true) {
+          const auto received{recv(fd, buffer, sizeof(buffer), 0)};
+
+          if (received > 0) {
+            c.in.append(buffer, static_cast<size_t>(received));
+
+            if (c.in.size() > m_options.max_request_size * 2) {
+              break;
+            }
+          } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            c.closing = true;
+            break;
+          } else {
+            break;
+          }
+        }
+
+        const auto peer_closed{c.closing};
+
+        c.closing = false;
+        process(c);
+        c.closing = c.closing || peer_closed;
+      }
+
+      if (open) {
+        open = flush(fd, c);
+      }
+
+      if (!open) {
+        close_connection(fd);
+      }
+    }
+
+    if (now - last_sweep >= 1) {
+      last_sweep = now;
+
+      for (auto it{connections.begin()}; it != connections.end();) {
+        if (now - it->second.last_active > m_options.idle_timeout) {
+          close(it->first);
+          it = connections.erase(it);
+        } else {
+          it++;
+        }
+      }
+    }
+  }
+
+  for (const auto& c: connections) {
+    close(c.first);
+  }
+
+  close(epoll_fd);
+}
+
+void webhook_server::start() {
+  if (m_running.load()) {
+    return;
+  }
+
+  sockaddr_in address{};
+
+  address.sin_family = AF_INET;
+  address.sin_port = htons(m_options.port);
+
+  if (inet_pton(AF_INET, m_options.address.c_str(), &address.sin_addr) != 1) {
+    throw std::invalid_argument{"Invalid webhook address."};
+  }
+
+  auto acceptors{m_options.acceptors};
+
+  if (acceptors == 0) {
+    acceptors = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+
+  const auto close_listeners{[this]() {
+    for (const auto fd: m_listeners) {
+      close(fd);
+    }
+
+    m_listeners.clear();
+  }};
+
+  /**
+   * Every acceptor gets its own SO_REUSEPORT socket bound to the same port, letting the kernel spread new connections across them without a shared accept queue.
+   */
+  for (size_t i{}; i < acceptors; i++) {
+    const auto fd{socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)};
+
+    if (fd < 0) {
+      close_listeners();
+      throw std::runtime_error{"Failed to listen on the webhook address."};
+    }
+
+    m_listeners.push_back(fd);
+
+    const int enabled{1};
+
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+    setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &enabled, sizeof(enabled));
+
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+      close_listeners();
+      throw std::runtime_error{"Failed to listen on the webhook address."};
+    }
+  }
+
+  m_stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+  if (m_stop_fd < 0) {
+    close_listeners();
+    throw std::runtime_error{"Failed to listen on the webhook address."};
+  }
+
+  for (size_t i{}; i < std::max<size_t>(m_options.workers, 1); i++) {
+    m_workers.push_back(std::make_unique<webhook_worker>());
+  }
+
+  m_running.store(true);
+
+  for (const auto fd: m_listeners) {
+    m_acceptor_threads.emplace_back([this, fd]() {
+      accept_loop(fd);
+    });
+  }
+}
+
+void webhook_server::stop() noexcept {
+  if (!m_running.exchange(false)) {
+    return;
+  }
+
+  /**
+   * The eventfd is never read, so it wakes up every acceptor's epoll_wait at once.
+   */
+  const uint64_t value{1};
+
+  TOPGG_UNUSED const auto written{write(m_stop_fd, &value, sizeof(value))};
+
+  for (auto& t: m_acceptor_threads) {
+    t.join();
+  }
+
+  m_acceptor_threads.clear();
+
+  for (const auto fd: m_listeners) {
+    close(fd);
+  }
+
+  m_listeners.clear();
+  m_workers.clear();
+
+  close(m_stop_fd);
+  m_stop_fd = -1;
+}
+
+webhook_server::~webhook_server() {
+  stop();
+}
+
+#endif
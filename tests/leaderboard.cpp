@@ -0,0 +1,87 @@
+/**
+ * Checks the leaderboard's ranks and top-K listings when users tie, against a brute-force count.
+ */
+
+#include <topgg/topgg.h>
+
+#include "test.h"
+
+#include <map>
+#include <random>
+
+int main() {
+  topgg::leaderboard board{};
+
+  // 10, 20 and 60 tie for first, 30 and 40 tie for fourth, 50 is sixth
+  board.ingest(10, 0, 3);
+  board.ingest(20, 0, 2);
+  board.ingest(30, 0, 1);
+  board.ingest(40, 0, 1);
+  board.ingest(50, 0, 1);
+  board.ingest(20, 0, 1);
+  board.ingest(30, 0, 1);
+  board.ingest(40, 0, 1);
+  board.ingest(60, 0, 3);
+
+  TOPGG_CHECK(board.size() == 6);
+  TOPGG_CHECK(board.rank(10) == 1);
+  TOPGG_CHECK(board.rank(20) == 1);
+  TOPGG_CHECK(board.rank(60) == 1);
+  TOPGG_CHECK(board.rank(30) == 4);
+  TOPGG_CHECK(board.rank(40) == 4);
+  TOPGG_CHECK(board.rank(50) == 6);
+  TOPGG_CHECK(!board.rank(70).has_value());
+
+  // users with the same amount of votes are listed in the order they reached it
+  const auto top{board.top(6)};
+
+  TOPGG_CHECK(top.size() == 6);
+  TOPGG_CHECK(top[0].user_id == 10 && top[0].votes == 3 && top[0].rank == 1);
+  TOPGG_CHECK(top[1].user_id == 20 && top[1].votes == 3 && top[1].rank == 1);
+  TOPGG_CHECK(top[2].user_id == 60 && top[2].votes == 3 && top[2].rank == 1);
+  TOPGG_CHECK(top[3].user_id == 30 && top[3].votes == 2 && top[3].rank == 4);
+  TOPGG_CHECK(top[4].user_id == 40 && top[4].votes == 2 && top[4].rank == 4);
+  TOPGG_CHECK(top[5].user_id == 50 && top[5].votes == 1 && top[5].rank == 6);
+
+  // cutting the listing in the middle of a tie keeps the shared rank
+  const auto cut{board.top(2)};
+
+  TOPGG_CHECK(cut.size() == 2 && cut[1].user_id == 20 && cut[1].rank == 1);
+  TOPGG_CHECK(board.top(100).size() == 6);
+  TOPGG_CHECK(board.top(0).empty());
+
+  board.reset();
+
+  TOPGG_CHECK(board.size() == 0 && board.top(3).empty() && board.votes(10) == 0);
+
+  // lots of ties, since 2000 users share a handful of distinct vote counts
+  std::mt19937_64 random{1};
+  std::map<uint64_t, size_t> expected{};
+
+  for (size_t i{}; i < 20000; i++) {
+    const auto user_id{(random() % 2000 + 1) << 22};
+    const auto votes{static_cast<size_t>(random() % 500 == 0 ? 100 : 1 + (random() % 7 == 0))};
+
+    board.ingest(user_id, 0, votes);
+    expected[user_id] += votes;
+  }
+
+  const auto all{board.top(expected.size())};
+
+  TOPGG_CHECK(all.size() == expected.size());
+
+  for (size_t i{}; i < all.size(); i++) {
+    size_t greater{};
+
+    for (const auto& user: expected) {
+      greater += user.second > all[i].votes;
+    }
+
+    TOPGG_CHECK(expected[all[i].user_id] == all[i].votes);
+    TOPGG_CHECK(i == 0 || all[i].votes <= all[i - 1].votes);
+    TOPGG_CHECK(all[i].rank == greater + 1);
+    TOPGG_CHECK(board.rank(all[i].user_id) == all[i].rank);
+  }
+
+  return 0;
+}
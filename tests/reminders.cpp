@@ -0,0 +1,153 @@
+/**
+ * Checks that reminders fire exactly at their deadline when it falls on or next to a boundary of the timer wheel's levels, where they have to cascade down.
+ */
+
+#include <topgg/topgg.h>
+
+#include "test.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace topgg {
+  class internal_test_access {
+  public:
+    static void set_now(reminder_scheduler& scheduler, const time_t now) {
+      std::lock_guard lock{scheduler.m_mutex};
+
+      scheduler.m_now = now;
+    }
+
+    static std::vector<dpp::snowflake> advance(reminder_scheduler& scheduler, const time_t now) {
+      std::lock_guard lock{scheduler.m_mutex};
+      std::vector<dpp::snowflake> due{};
+
+      scheduler.advance(now, due);
+
+      return due;
+    }
+  };
+}; // namespace topgg
+
+using topgg::internal_test_access;
+
+static constexpr time_t LEVEL_1{256};
+static constexpr time_t LEVEL_2{256 * 256};
+static constexpr time_t LEVEL_3{256 * 256 * 256};
+
+static void check_boundaries(dpp::cluster& cluster, const time_t start) {
+  topgg::reminder_scheduler scheduler{cluster, [](TOPGG_UNUSED const auto& due) {}};
+  std::map<time_t, std::vector<uint64_t>> expected{};
+  uint64_t user_id{1};
+
+  internal_test_access::set_now(scheduler, start);
+
+  const auto add{[&](const time_t deadline) {
+    scheduler.schedule(user_id, deadline);
+    expected[std::max(deadline, start + 1)].push_back(user_id++);
+  }};
+
+  // relative to now, around the span of every level
+  for (const auto span: {time_t{1}, LEVEL_1, LEVEL_2, LEVEL_3}) {
+    add(start + span - 1);
+    add(start + span);
+    add(start + span + 1);
+  }
+
+  // on and around the next absolute boundary of every level, where the higher levels cascade
+  for (const auto span: {LEVEL_1, LEVEL_2, LEVEL_3}) {
+    const auto boundary{(start / span + 1) * span};
+
+    add(boundary - 1);
+    add(boundary);
+    add(boundary + 1);
+    add(boundary + span);
+  }
+
+  // overdue reminders fire on the next second
+  add(start - 1000);
+  add(start);
+
+  for (const auto& deadline: expected) {
+    TOPGG_CHECK(internal_test_access::advance(scheduler, deadline.first - 1).empty());
+
+    auto due{internal_test_access::advance(scheduler, deadline.first)};
+    auto users{deadline.second};
+
+    std::sort(due.begin(), due.end());
+    std::sort(users.begin(), users.end());
+
+    TOPGG_CHECK(std::equal(due.begin(), due.end(), users.begin(), users.end()));
+  }
+
+  TOPGG_CHECK(scheduler.size() == 0);
+}
+
+int main() {
+  dpp::cluster cluster{"token"};
+
+  for (const auto start: {time_t{0}, LEVEL_1 - 1, LEVEL_2 - 1, LEVEL_3 - 1, LEVEL_3 + LEVEL_2 - 2, time_t{0x12345678}}) {
+    check_boundaries(cluster, start);
+  }
+
+  // a reminder that's cancelled after cascading down doesn't fire, and doesn't take others down with it
+  {
+    topgg::reminder_scheduler scheduler{cluster, [](TOPGG_UNUSED const auto& due) {}};
+
+    internal_test_access::set_now(scheduler, LEVEL_2 - 10);
+
+    const auto cancelled{scheduler.schedule(1, LEVEL_2 + 5)};
+
+    scheduler.schedule(2, LEVEL_2 + 5);
+
+    TOPGG_CHECK(internal_test_access::advance(scheduler, LEVEL_2).empty());
+    TOPGG_CHECK(scheduler.cancel(cancelled));
+    TOPGG_CHECK(!scheduler.cancel(cancelled));
+
+    const auto due{internal_test_access::advance(scheduler, LEVEL_2 + 5)};
+
+    TOPGG_CHECK(due.size() == 1 && due[0] == 2);
+  }
+
+  // random deadlines against a sorted reference
+  {
+    topgg::reminder_scheduler scheduler{cluster, [](TOPGG_UNUSED const auto& due) {}};
+    std::mt19937_64 random{7};
+    std::multimap<time_t, uint64_t> expected{};
+    time_t now{LEVEL_3 - 1000};
+    uint64_t user_id{1};
+
+    internal_test_access::set_now(scheduler, now);
+
+    for (size_t step{}; step < 5000; step++) {
+      const auto added{random() % 10};
+
+      for (size_t i{}; i < added; i++) {
+        const auto deadline{now + static_cast<time_t>(random() % 2 == 0 ? random() % 600 : random() % 200000)};
+
+        scheduler.schedule(user_id, deadline);
+        expected.emplace(std::max(deadline, now + 1), user_id++);
+      }
+
+      now += static_cast<time_t>(random() % 100 == 0 ? random() % 100000 : random() % 5);
+
+      auto due{internal_test_access::advance(scheduler, now)};
+      std::vector<uint64_t> users{};
+
+      while (!expected.empty() && expected.begin()->first <= now) {
+        users.push_back(expected.begin()->second);
+        expected.erase(expected.begin());
+      }
+
+      std::sort(due.begin(), due.end());
+      std::sort(users.begin(), users.end());
+
+      TOPGG_CHECK(std::equal(due.begin(), due.end(), users.begin(), users.end()));
+      TOPGG_CHECK(scheduler.size() == expected.size());
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * Checks that the shared cache keeps bots apart, never returns a torn entry while threads and processes race to store and find it, and reclaims an entry left locked by a process that died mid-write.
+ */
+
+#include <topgg/topgg.h>
+
+#include "test.h"
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace topgg {
+  class internal_test_access {
+  public:
+    static bool find(const shared_cache& cache, const dpp::snowflake bot_id, const dpp::snowflake id, std::string& out) {
+      return cache.find(bot_id, shared_cache::vote_endpoint, id, out);
+    }
+
+    static void store(shared_cache& cache, const dpp::snowflake bot_id, const dpp::snowflake id, const std::string& body) {
+      cache.store(bot_id, shared_cache::vote_endpoint, id, body);
+    }
+
+    // the first entry's lock word sits right after the 64-byte header
+    static std::atomic<uint64_t>& first_lock(shared_cache& cache) {
+      return *reinterpret_cast<std::atomic<uint64_t>*>(cache.m_mapping + 64);
+    }
+  };
+}; // namespace topgg
+
+using topgg::internal_test_access;
+
+/**
+ * Every writer stores a body made of one repeated letter, whose length depends on the letter, so a torn read shows up as a mixed or mis-sized body.
+ */
+static std::string make_body(const char letter) {
+  return std::string(1000 + static_cast<size_t>(letter - 'a') * 131, letter);
+}
+
+static bool is_whole(const std::string& body) {
+  return !body.empty() && body.find_first_not_of(body[0]) == std::string::npos && body == make_body(body[0]);
+}
+
+/**
+ * Runs for a fixed time rather than a fixed amount of iterations, so that the threads get preempted mid-copy even on a single core.
+ */
+static void race(topgg::shared_cache& cache, const char first_letter) {
+  const auto deadline{std::chrono::steady_clock::now() + std::chrono::milliseconds(500)};
+  std::vector<std::thread> threads{};
+  std::atomic<bool> torn{};
+
+  for (size_t i{}; i < 4; i++) {
+    threads.emplace_back([&cache, &torn, deadline, i, first_letter]() {
+      std::string body{};
+
+      for (size_t j{}; std::chrono::steady_clock::now() < deadline; j++) {
+        if (i % 2 == 0) {
+          internal_test_access::store(cache, 1, 42, make_body(static_cast<char>(first_letter + (j + i) % 4)));
+        } else if (internal_test_access::find(cache, 1, 42, body) && !is_whole(body)) {
+          torn = true;
+        }
+      }
+    });
+  }
+
+  for (auto& thread: threads) {
+    thread.join();
+  }
+
+  TOPGG_CHECK(!torn);
+}
+#endif
+
+int main() {
+#ifndef _WIN32
+  const auto name{"/topgg-test-cache-" + std::to_string(getpid())};
+  topgg::shared_cache_options options{};
+
+  // a single entry makes every key contend for it
+  options.capacity = 1;
+
+  topgg::shared_cache::unlink(name);
+
+  {
+    topgg::shared_cache cache{name, options};
+    std::string body{};
+
+    // the same user's vote is cached separately for every bot
+    internal_test_access::store(cache, 1, 42, "first");
+
+    TOPGG_CHECK(internal_test_access::find(cache, 1, 42, body) && body == "first");
+    TOPGG_CHECK(!internal_test_access::find(cache, 2, 42, body));
+
+    internal_test_access::store(cache, 2, 42, "second");
+
+    TOPGG_CHECK(internal_test_access::find(cache, 2, 42, body) && body == "second");
+    TOPGG_CHECK(!internal_test_access::find(cache, 1, 42, body));
+
+    // threads in this process race with threads in a child process opening the same segment
+    const auto child{fork()};
+
+    if (child == 0) {
+      topgg::shared_cache child_cache{name};
+
+      race(child_cache, 'e');
+      std::_Exit(0);
+    }
+
+    race(cache, 'a');
+
+    int status{};
+
+    TOPGG_CHECK(waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    // an entry that's locked by a live process is skipped rather than waited for
+    auto& lock{internal_test_access::first_lock(cache)};
+    const auto unlocked{lock.load()};
+
+    lock.store((static_cast<uint64_t>(getpid()) << 32) | 1);
+    internal_test_access::store(cache, 3, 42, "third");
+
+    TOPGG_CHECK(!internal_test_access::find(cache, 3, 42, body));
+
+    // an entry that's locked by a process that died is taken over
+    const auto dead{fork()};
+
+    if (dead == 0) {
+      std::_Exit(0);
+    }
+
+    TOPGG_CHECK(waitpid(dead, &status, 0) == dead);
+
+    lock.store((static_cast<uint64_t>(dead) << 32) | (static_cast<uint32_t>(unlocked) | 1));
+    internal_test_access::store(cache, 3, 42, "third");
+
+    TOPGG_CHECK(internal_test_access::find(cache, 3, 42, body) && body == "third");
+    TOPGG_CHECK((lock.load() & 1) == 0);
+  }
+
+  topgg::shared_cache::unlink(name);
+#endif
+
+  return 0;
+}
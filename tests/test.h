@@ -0,0 +1,20 @@
+/**
+ * @file test.h
+ * @brief A minimal assertion harness shared by the tests. Build them with -DTOPGG_BUILD_TESTS=ON and run them with ctest.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * Unlike assert, checks still run in Release mode. A failed check prints where it failed and ends the test.
+ */
+#define TOPGG_CHECK(condition)                                                            \
+  do {                                                                                    \
+    if (!(condition)) {                                                                   \
+      std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      std::exit(1);                                                                       \
+    }                                                                                     \
+  } while (0)
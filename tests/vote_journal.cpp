@@ -0,0 +1,133 @@
+/**
+ * Checks that replaying a vote journal stops at a torn record, that appending afterwards overwrites it instead of resurrecting the records after it, and that a failed rollover leaves the journal usable.
+ */
+
+#include <topgg/topgg.h>
+
+#include "test.h"
+
+#ifndef _WIN32
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+static size_t count_records(topgg::vote_journal& journal) {
+  size_t count{};
+
+  journal.replay([&count](TOPGG_UNUSED const topgg::journal_record& record) {
+    count++;
+  });
+
+  return count;
+}
+#endif
+
+int main() {
+#ifndef _WIN32
+  const std::string directory{"topgg_test_vote_journal"};
+  topgg::vote_journal_options options{};
+
+  options.segment_records = 100;
+
+  std::filesystem::remove_all(directory);
+
+  {
+    topgg::vote_journal journal{directory, options};
+
+    for (uint64_t i{}; i < 250; i++) {
+      journal.append(1000 + i, 100);
+    }
+
+    size_t replayed{};
+
+    journal.replay([&replayed](const topgg::journal_record& record) {
+      TOPGG_CHECK(record.voter_id == 1000 + replayed);
+      replayed++;
+    });
+
+    TOPGG_CHECK(replayed == 250);
+  }
+
+  // tears the 11th record of the active segment, which holds records 200 to 249
+  {
+    std::fstream segment{directory + "/0000000000000002.journal", std::ios::in | std::ios::out | std::ios::binary};
+    const char torn{0x7f};
+
+    TOPGG_CHECK(segment.is_open());
+
+    segment.seekp(64 + 24 * 10);
+    segment.write(&torn, 1);
+  }
+
+  {
+    topgg::vote_journal journal{directory, options};
+
+    TOPGG_CHECK(count_records(journal) == 210);
+
+    journal.append(7, 200);
+
+    size_t replayed{};
+
+    journal.replay([&replayed](const topgg::journal_record& record) {
+      TOPGG_CHECK(replayed != 210 || record.voter_id == 7);
+      replayed++;
+    });
+
+    TOPGG_CHECK(replayed == 211);
+  }
+
+  // a reopened journal must not find the records that were after the torn one either
+  {
+    topgg::vote_journal journal{directory, options};
+
+    TOPGG_CHECK(count_records(journal) == 211);
+  }
+
+  std::filesystem::remove_all(directory);
+
+  {
+    options.segment_records = 10;
+
+    topgg::vote_journal journal{directory, options};
+
+    for (uint64_t i{}; i < 10; i++) {
+      journal.append(i, 100);
+    }
+
+    // a directory in the way of the next segment makes every rollover fail
+    const auto next_segment{directory + "/0000000000000001.journal"};
+
+    std::filesystem::create_directory(next_segment);
+
+    for (size_t attempt{}; attempt < 2; attempt++) {
+      auto threw{false};
+
+      try {
+        journal.append(10, 100);
+      } catch (const std::runtime_error&) {
+        threw = true;
+      }
+
+      TOPGG_CHECK(threw);
+      TOPGG_CHECK(count_records(journal) == 10);
+    }
+
+    std::filesystem::remove(next_segment);
+
+    journal.append(10, 100);
+
+    size_t replayed{};
+
+    journal.replay([&replayed](const topgg::journal_record& record) {
+      TOPGG_CHECK(record.voter_id == replayed);
+      replayed++;
+    });
+
+    TOPGG_CHECK(replayed == 11);
+  }
+
+  std::filesystem::remove_all(directory);
+#endif
+
+  return 0;
+}